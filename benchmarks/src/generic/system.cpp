@@ -0,0 +1,89 @@
+#include <coli/game-engine.h>
+#include <coli/game/components/transform.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace Coli;
+
+namespace
+{
+    using Transform = Game::Components::Transform3D;
+
+    struct Velocity {
+        Types::vector_type<false> value { static_cast<Types::float_type>(1) };
+    };
+
+    class VirtualMove final :
+        public Generic::SystemBase<Transform, Velocity const>
+    {
+    public:
+        void process(Transform& transform, Velocity const& velocity) override {
+            transform.position += velocity.value;
+        }
+
+        void update() override {}
+    };
+
+    class StaticMove final :
+        public Generic::StaticSystem<StaticMove, Transform, Velocity const>
+    {
+    public:
+        void process(Transform& transform, Velocity const& velocity) {
+            transform.position += velocity.value;
+        }
+    };
+
+    [[nodiscard]] double measure(
+        Generic::Detail::SystemBase& system,
+        Game::Scene& scene,
+        Generic::Frame const& frame,
+        int frames)
+    {
+        using clock = std::chrono::steady_clock;
+
+        system.prepare(scene, frame);
+        system.execute(scene, frame);
+
+        auto const start = clock::now();
+
+        for (int i = 0; i < frames; ++i)
+            system.execute(scene, frame);
+
+        std::chrono::duration<double, std::milli> const elapsed = clock::now() - start;
+        return elapsed.count() / frames;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    auto const count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000ull;
+    auto const frames = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    Game::Scene scene;
+    Generic::WorkerPool workers { 0 };
+    Generic::FrameArena arena { workers.slot_count() };
+    Generic::FrameCommands commands { workers.slot_count() };
+    Generic::EventBus events { workers.slot_count() };
+    Generic::FrameTimers timers { workers.slot_count() };
+    Generic::Frame const frame { workers, arena, commands, events, timers };
+
+    for (unsigned long long i = 0; i < count; ++i) {
+        auto object = scene.create();
+
+        object.emplace<Transform>();
+        object.emplace<Velocity>();
+    }
+
+    VirtualMove virtualSystem;
+    StaticMove staticSystem;
+
+    auto const virtualTime = measure(virtualSystem, scene, frame, frames);
+    auto const staticTime = measure(staticSystem, scene, frame, frames);
+
+    std::cout << "objects: " << count << ", frames: " << frames << '\n'
+              << "virtual: " << virtualTime << " ms/frame\n"
+              << "static:  " << staticTime << " ms/frame\n"
+              << "speedup: " << virtualTime / staticTime << "x\n";
+}
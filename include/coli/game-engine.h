@@ -5,11 +5,36 @@
 #include "coli/utility.h"
 
 #include "coli/game/components/layer.h"
+#include "coli/game/components/double_buffered.h"
+#include "coli/game/components/time_to_live.h"
 #include "coli/game/object.h"
+#include "coli/game/object_ref.h"
 #include "coli/game/scene.h"
+#include "coli/game/scene_access.h"
+#include "coli/game/prefab.h"
+#include "coli/game/command_buffer.h"
+#include "coli/game/observer.h"
 
+#include "coli/generic/worker_pool.h"
+#include "coli/generic/frame_arena.h"
+#include "coli/generic/frame_commands.h"
+#include "coli/generic/event_bus.h"
+#include "coli/generic/timer_wheel.h"
+#include "coli/generic/frame.h"
+#include "coli/generic/run_policy.h"
 #include "coli/generic/system.h"
+#include "coli/generic/parallel_system.h"
+#include "coli/generic/static_system.h"
+#include "coli/generic/batch_system.h"
+#include "coli/generic/reactive_system.h"
+#include "coli/generic/render_exchange.h"
+#include "coli/generic/extract_system.h"
+#include "coli/generic/scheduler.h"
+#include "coli/generic/stats.h"
+#include "coli/generic/task.h"
+#include "coli/generic/shard.h"
 #include "coli/generic/engine.h"
+#include "coli/generic/time_to_live_system.h"
 
 #include "coli/graphics/context.h"
 #include "coli/graphics/window.h"
@@ -0,0 +1,262 @@
+#ifndef COLI_GAME_COMMAND_BUFFER_H
+#define COLI_GAME_COMMAND_BUFFER_H
+
+#include "coli/utility.h"
+#include "coli/game/object.h"
+#include "coli/game/scene.h"
+
+/**
+ * @brief For internal details.
+ * @note The user should not use this namespace.
+ */
+namespace Coli::Game::Detail
+{
+    class COLI_EXPORT ComponentCommandsBase
+    {
+    public:
+        virtual ~ComponentCommandsBase() noexcept = default;
+
+        virtual void apply(entt::registry& registry) = 0;
+        virtual void clear() noexcept = 0;
+    };
+
+    template <class T>
+    class ComponentCommands final :
+        public ComponentCommandsBase
+    {
+        struct Command
+        {
+            entt::entity entity;
+            std::optional<T> value;
+        };
+
+    public:
+        template <class... Args>
+        void emplace(entt::entity entity, Args&&... args) {
+            myCommands.push_back({ entity, std::optional<T>(std::in_place, std::forward<Args>(args)...) });
+        }
+
+        void remove(entt::entity entity) {
+            myCommands.push_back({ entity, std::nullopt });
+        }
+
+        void apply(entt::registry& registry) override
+        {
+            for (auto& command : myCommands)
+                if (registry.valid(command.entity))
+                {
+                    if (command.value)
+                        registry.emplace_or_replace<T>(command.entity, std::move(*command.value));
+                    else
+                        registry.remove<T>(command.entity);
+                }
+        }
+
+        void clear() noexcept override {
+            myCommands.clear();
+        }
+
+    private:
+        std::vector<Command> myCommands;
+    };
+}
+
+/// @brief Namespace for the all game-related stuff.
+namespace Coli::Game
+{
+    /**
+     * @brief Command buffer.
+     * @details Records structural changes of a scene to apply them later:
+     * creation and destruction of objects, addition and removal of
+     * components. Objects are created with the identifiers reserved in
+     * the scene, so the components can be added to them before they exist.
+     *
+     * On flush, the reserved objects are created first, then the component
+     * changes are applied grouped by the component type, then the objects
+     * are destroyed. The changes of the same type keep their order.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization. Use a buffer per thread.
+     */
+    class COLI_EXPORT CommandBuffer final
+    {
+        using commands_entry = std::pair<entt::id_type, std::unique_ptr<Detail::ComponentCommandsBase>>;
+
+        [[noreturn]] static void fail_unbound();
+
+        template <class T>
+        [[nodiscard]] Detail::ComponentCommands<T>& commands()
+        {
+            auto const id = entt::type_hash<T>::value();
+            auto place = std::ranges::lower_bound(myComponents, id, {}, &commands_entry::first);
+
+            if (place == myComponents.end() || place->first != id)
+                place = myComponents.emplace(place, id, std::make_unique<Detail::ComponentCommands<T>>());
+
+            myIsEmpty = false;
+            return static_cast<Detail::ComponentCommands<T>&>(*place->second);
+        }
+
+    public:
+        /**
+         * @brief Creates command buffer.
+         * @details Creates a buffer that is not bound to a scene.
+         * Bind it before recording the creations.
+         */
+        CommandBuffer() noexcept;
+
+        /**
+         * @brief Creates command buffer.
+         * @details Creates a buffer bound to the scene.
+         *
+         * @param scene Scene to record the changes of.
+         */
+        explicit CommandBuffer(Scene& scene) noexcept;
+
+        /**
+         * @brief Moves command buffer.
+         * @details Just moves the recorded commands.
+         *
+         * @param other Other buffer.
+         */
+        CommandBuffer(CommandBuffer&& other) noexcept;
+        CommandBuffer(CommandBuffer const&) = delete;
+
+        /// @copydoc CommandBuffer(CommandBuffer&&)
+        CommandBuffer& operator=(CommandBuffer&& other) noexcept;
+        CommandBuffer& operator=(CommandBuffer const&) = delete;
+
+        /**
+         * @brief Destroys command buffer.
+         * @details Drops the commands that have not been flushed.
+         */
+        ~CommandBuffer() noexcept;
+
+        /**
+         * @brief Binds scene.
+         * @details Binds the buffer to the scene the objects
+         * are created in.
+         *
+         * @param scene Scene to record the changes of.
+         */
+        void bind(Scene& scene) noexcept;
+
+        /**
+         * @brief Records creation.
+         * @details Reserves an entity in the bound scene. It is created
+         * on flush, but components may be added to it right away.
+         *
+         * @throw std::logic_error If the buffer is not bound to a scene.
+         *
+         * @return Reserved entity.
+         */
+        [[nodiscard]] entt::entity create();
+
+        /**
+         * @brief Records destruction.
+         * @details Destroys the entity on flush.
+         *
+         * @param entity Entity to destroy.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void destroy(entt::entity entity);
+
+        /**
+         * @brief Records destruction.
+         * @details Destroys the handled object on flush.
+         *
+         * @param handle Handle to the object to destroy.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void destroy(ObjectHandle const& handle);
+
+        /**
+         * @brief Records component addition.
+         * @details Creates the component now and moves it to the entity on
+         * flush, replacing the existing one. Skipped if the entity does not
+         * exist on flush.
+         *
+         * @tparam T Type of component to add;
+         * @tparam Args Types of argument passed to the component constructor.
+         *
+         * @param entity Entity to add the component to;
+         * @param args Argument passed to the component constructor.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw T Any T(Args...) exception.
+         */
+        template <class T, class... Args>
+            requires (std::constructible_from<std::remove_cvref_t<T>, Args...>)
+        void emplace(entt::entity entity, Args&&... args) {
+            commands<std::remove_cvref_t<T>>().emplace(entity, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Records component removal.
+         * @details Removes the component from the entity on flush.
+         *
+         * @tparam T Type of component to remove.
+         *
+         * @param entity Entity to remove the component from.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        template <class T>
+        void remove(entt::entity entity) {
+            commands<std::remove_cvref_t<T>>().remove(entity);
+        }
+
+        /**
+         * @brief Checks buffer is empty.
+         * @details Checks there are no recorded commands.
+         *
+         * @return Checking result.
+         *
+         * @retval True If no commands are recorded;
+         * @retval False Otherwise.
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Clears buffer.
+         * @details Drops all the recorded commands. The reserved entities
+         * are still created by the next structural change of the scene.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Flushes buffer.
+         * @details Applies the recorded commands to the bound scene
+         * and clears the buffer.
+         *
+         * @throw std::logic_error If the buffer is not bound to a scene;
+         * @throw std::bad_alloc If allocation fails;
+         * @throw Any Exceptions of the component constructors.
+         */
+        void flush();
+
+        /**
+         * @brief Flushes buffers.
+         * @details Applies the commands of all the buffers to the scene
+         * at once, so the changes of each component type are applied
+         * together, and clears the buffers.
+         *
+         * @param scene Scene to apply the commands to;
+         * @param buffers Buffers to flush.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw Any Exceptions of the component constructors.
+         */
+        static void flush(Scene& scene, std::span<CommandBuffer* const> buffers);
+
+    private:
+        Scene* myScene;
+        std::vector<entt::entity> myDestroyed;
+        std::vector<commands_entry> myComponents;
+        bool myIsEmpty;
+    };
+}
+
+#endif
@@ -0,0 +1,217 @@
+#ifndef COLI_GAME_COMPONENTS_DOUBLE_BUFFERED_H
+#define COLI_GAME_COMPONENTS_DOUBLE_BUFFERED_H
+
+#include "coli/utility.h"
+
+namespace Coli::Game
+{
+    class Scene;
+}
+
+/**
+ * @brief For internal details.
+ * @note The user should not use this namespace.
+ */
+namespace Coli::Game::Detail
+{
+    class COLI_EXPORT BufferState final
+    {
+    public:
+        BufferState() noexcept;
+
+        BufferState(BufferState&&) = delete;
+        BufferState(BufferState const&) = delete;
+
+        BufferState& operator=(BufferState&&) = delete;
+        BufferState& operator=(BufferState const&) = delete;
+
+        ~BufferState() noexcept;
+
+        [[nodiscard]] std::size_t front() const noexcept;
+
+        void written() noexcept;
+        void swap() noexcept;
+
+    private:
+        std::atomic<bool> myIsWritten;
+        std::size_t myFront;
+    };
+
+    template <class T>
+    struct FrontBuffer {};
+
+    template <class T>
+    struct BackBuffer {};
+}
+
+namespace Coli::Game::Components
+{
+    /**
+     * @brief Double-buffered component class.
+     * @details Stores the previous and the next state of a component.
+     * The systems read the front buffer and write the back one, so
+     * a system may read the state of any object while others are
+     * written, with no locks and with results independent of the
+     * processing order. The scheduler does not consider the readers of
+     * the front buffer conflicting with the writer of the back one. After
+     * a frame in which the back buffers were written, the engine swaps
+     * the buffers of the whole type at once.
+     *
+     * Use it as `DoubleBuffered<T> const` in a system signature to read
+     * the front buffer only, or as `DoubleBuffered<T>` to also write the
+     * back one. The writer must assign the back buffer of every object
+     * it processes, since the back buffer keeps the state of two
+     * frames ago, so it should not be executed within a time budget.
+     *
+     * @tparam T Type of the state.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    template <std::copyable T>
+    class DoubleBuffered final
+    {
+        friend class Game::Scene;
+
+        [[nodiscard]] std::size_t front_index() const noexcept {
+            return myState ? myState->front() : 0;
+        }
+
+    public:
+        /// @brief Type of the state.
+        using value_type = T;
+
+        /**
+         * @brief Creates double-buffered component.
+         * @details Creates both the buffers with the default state.
+         *
+         * @throw T Any of T() constructor exceptions.
+         */
+        DoubleBuffered() = default;
+
+        /**
+         * @brief Creates double-buffered component.
+         * @details Creates both the buffers with the specific state.
+         *
+         * @param value Initial state.
+         *
+         * @throw T Any of T(T const&) constructor exceptions.
+         */
+        explicit DoubleBuffered(T const& value) :
+            myValues { value, value }
+        {}
+
+        /**
+         * @brief Copies double-buffered component.
+         * @details Creates the buffers with the copies of the other's ones,
+         * bound to the same buffer state.
+         *
+         * @param other Other double-buffered component.
+         *
+         * @throw T Any of T(T const&) constructor exceptions.
+         */
+        DoubleBuffered(DoubleBuffered const& other) = default;
+
+        /**
+         * @brief Moves double-buffered component.
+         * @details Creates the buffers with the moved other's ones,
+         * bound to the same buffer state.
+         *
+         * @param other Other double-buffered component.
+         *
+         * @throw T Any of T(T&&) constructor exceptions.
+         */
+        DoubleBuffered(DoubleBuffered&& other) noexcept(std::is_nothrow_move_constructible_v<T>) = default;
+
+        /**
+         * @brief Copies buffers.
+         * @details Copies the other's front and back buffers into this
+         * component's front and back ones. Keeps the buffer state this
+         * component is bound to, so replacing the component of an object
+         * keeps it swapped with the other components of its type.
+         *
+         * @param other Other double-buffered component.
+         *
+         * @throw T Any of T::operator=(T const&) exceptions.
+         *
+         * @return Reference to this component.
+         */
+        DoubleBuffered& operator=(DoubleBuffered const& other)
+        {
+            auto const from = other.front_index();
+            auto const to = front_index();
+
+            myValues[to] = other.myValues[from];
+            myValues[to ^ 1] = other.myValues[from ^ 1];
+
+            return *this;
+        }
+
+        /**
+         * @brief Moves buffers.
+         * @details Moves the other's front and back buffers into this
+         * component's front and back ones. Keeps the buffer state this
+         * component is bound to.
+         *
+         * @param other Other double-buffered component.
+         *
+         * @throw T Any of T::operator=(T&&) exceptions.
+         *
+         * @return Reference to this component.
+         */
+        DoubleBuffered& operator=(DoubleBuffered&& other) noexcept(std::is_nothrow_move_assignable_v<T>)
+        {
+            auto const from = other.front_index();
+            auto const to = front_index();
+
+            myValues[to] = std::move(other.myValues[from]);
+            myValues[to ^ 1] = std::move(other.myValues[from ^ 1]);
+
+            return *this;
+        }
+
+        /// @brief Destroys double-buffered component.
+        ~DoubleBuffered() = default;
+
+        /**
+         * @brief Returns front buffer.
+         * @details Returns the state of the previous frame.
+         *
+         * @return Reference to the front buffer.
+         */
+        [[nodiscard]] T const& front() const noexcept {
+            return myValues[front_index()];
+        }
+
+        /**
+         * @brief Returns back buffer.
+         * @details Returns the state to be written in this frame.
+         * It becomes the front buffer after the swap.
+         *
+         * @return Reference to the back buffer.
+         */
+        [[nodiscard]] T& back() noexcept {
+            return myValues[front_index() ^ 1];
+        }
+
+        /// @copydoc back()
+        [[nodiscard]] T const& back() const noexcept {
+            return myValues[front_index() ^ 1];
+        }
+
+    private:
+        std::array<T, 2> myValues {};
+        Detail::BufferState const* myState = nullptr;
+    };
+}
+
+namespace Coli::Game::Detail
+{
+    template <class T>
+    inline constexpr bool is_double_buffered = false;
+
+    template <class T>
+    inline constexpr bool is_double_buffered<Components::DoubleBuffered<T>> = true;
+}
+
+#endif
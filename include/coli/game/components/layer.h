@@ -3,6 +3,42 @@
 
 #include "coli/utility.h"
 
+/**
+ * @brief For internal details.
+ * @note The user should not use this namespace.
+ */
+namespace Coli::Game::Detail
+{
+    class COLI_EXPORT LayerOrder final
+    {
+        using sorter_type = void (*)(entt::registry&);
+
+    public:
+        LayerOrder() noexcept;
+
+        LayerOrder(LayerOrder&&) = delete;
+        LayerOrder(LayerOrder const&) = delete;
+
+        LayerOrder& operator=(LayerOrder&&) = delete;
+        LayerOrder& operator=(LayerOrder const&) = delete;
+
+        ~LayerOrder() noexcept;
+
+        [[nodiscard]] bool sorts(entt::id_type id) const noexcept;
+
+        void depend(entt::id_type id, sorter_type sorter);
+        void touch(entt::registry&, entt::entity) noexcept;
+        void written() noexcept;
+
+        bool update(entt::registry& registry);
+
+    private:
+        std::vector<std::pair<entt::id_type, sorter_type>> myDependents;
+        std::atomic<std::size_t> myTouched;
+        std::atomic<bool> myIsDirty;
+    };
+}
+
 namespace Coli::Game::Components
 {
     /**
@@ -11,7 +47,8 @@ namespace Coli::Game::Components
      * @details Stores the object's layer value for sorting in
      * the scene. Systems often processes the objects in the
      * certain order. Objects with lower layer values are processed
-     * firstly.
+     * firstly. See @ref Scene::keep_layer_order() to iterate them in
+     * the layer order.
      *
      * @note Not thread-safe. Concurrent access requires
      * external synchronization.
@@ -41,7 +78,7 @@ namespace Coli::Game::Components
          *
          * @param other Other layer component.
          */
-        Layer(const Layer& other) noexcept;
+        Layer(const Layer& other) noexcept = default;
 
         /**
          * @brief Moves the layer component.
@@ -50,7 +87,7 @@ namespace Coli::Game::Components
          *
          * @param other Other layer component.
          */
-        Layer(Layer&& other) noexcept;
+        Layer(Layer&& other) noexcept = default;
 
         /**
          * @brief Sets the layer value.
@@ -59,7 +96,7 @@ namespace Coli::Game::Components
          *
          * @param other Other layer component.
          */
-        Layer& operator=(const Layer& other) noexcept;
+        Layer& operator=(const Layer& other) noexcept = default;
 
         /**
          * @brief Moves the layer value.
@@ -68,10 +105,10 @@ namespace Coli::Game::Components
          *
          * @param other Other layer component.
          */
-        Layer& operator=(Layer&& other) noexcept;
+        Layer& operator=(Layer&& other) noexcept = default;
 
         /// @brief Destroys the layer component.
-        ~Layer() noexcept;
+        ~Layer() noexcept = default;
 
         /**
          * @brief Gets the layer value.
@@ -0,0 +1,78 @@
+#ifndef COLI_GAME_COMPONENTS_TIME_TO_LIVE_H
+#define COLI_GAME_COMPONENTS_TIME_TO_LIVE_H
+
+#include "coli/utility.h"
+
+namespace Coli::Game::Components
+{
+    /**
+     * @brief Time to live component class.
+     *
+     * @details Stores the simulated time after which the object is
+     * destroyed by @ref Coli::Generic::TimeToLiveSystem. The countdown
+     * starts when the system sees the component for the first time and
+     * restarts when it is replaced or patched, e.g. via
+     * @ref ObjectHandle::patch(). Objects that lose the component
+     * are not destroyed.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT TimeToLive final
+    {
+    public:
+        /**
+         * @brief Creates time to live.
+         * @details Creates a time to live component with the specific
+         * time. Objects with the zero time are destroyed on the first
+         * tick of the system after they are seen.
+         *
+         * @param seconds Time to live in seconds.
+         */
+        explicit TimeToLive(Types::float_type seconds = 0) noexcept;
+
+        /**
+         * @brief Copies time to live.
+         * @details Has the default implementation.
+         */
+        TimeToLive(TimeToLive const&) noexcept;
+
+        /**
+         * @brief Moves time to live.
+         * @details Has the default implementation.
+         */
+        TimeToLive(TimeToLive&&) noexcept;
+
+        /// @copydoc TimeToLive(TimeToLive const&)
+        TimeToLive& operator=(TimeToLive const&) noexcept;
+
+        /// @copydoc TimeToLive(TimeToLive&&)
+        TimeToLive& operator=(TimeToLive&&) noexcept;
+
+        /// @brief Destroys time to live.
+        ~TimeToLive() noexcept;
+
+        /**
+         * @brief Gets the time.
+         * @details Returns the time the object lives since
+         * the countdown starts.
+         *
+         * @return Time to live in seconds.
+         */
+        [[nodiscard]] Types::float_type seconds() const noexcept;
+
+        /**
+         * @brief Sets the time.
+         * @details Sets the time the object lives. Patch the component
+         * to restart the countdown with the new time.
+         *
+         * @param seconds Time to live in seconds.
+         */
+        void seconds(Types::float_type seconds) noexcept;
+
+    private:
+        Types::float_type mySeconds;
+    };
+}
+
+#endif
@@ -37,7 +37,7 @@ namespace Coli::Game::Components
          *
          * @param other Other transform component.
          */
-        BasicTransform(const BasicTransform& other) noexcept;
+        BasicTransform(const BasicTransform& other) noexcept = default;
 
         /**
          * @brief Moves the transform component.
@@ -45,7 +45,7 @@ namespace Coli::Game::Components
          *
          * @param other Other transform component.
          */
-        BasicTransform(BasicTransform&& other) noexcept;
+        BasicTransform(BasicTransform&& other) noexcept = default;
 
         /**
          * @brief Copies the transform component's values.
@@ -54,7 +54,7 @@ namespace Coli::Game::Components
          *
          * @param other Other transform component.
          */
-        BasicTransform& operator=(const BasicTransform& other) noexcept;
+        BasicTransform& operator=(const BasicTransform& other) noexcept = default;
 
         /**
          * @brief Moves the transform component's values.
@@ -63,7 +63,7 @@ namespace Coli::Game::Components
          *
          * @param other Other transform component.
          */
-        BasicTransform& operator=(BasicTransform&& other) noexcept;
+        BasicTransform& operator=(BasicTransform&& other) noexcept = default;
 
         /**
          * @brief Resets the transform to zeroes.
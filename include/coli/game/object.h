@@ -52,6 +52,8 @@ namespace Coli::Game
 
         friend class Scene;
         friend class Detail::ObjectsOrderer;
+        friend class CommandBuffer;
+        friend class SceneAccess;
 
         /**
          * @brief Creates handle that is bound to the other.
@@ -106,6 +108,15 @@ namespace Coli::Game
          */
         [[nodiscard]] bool expired() const noexcept;
 
+        /**
+         * @brief Returns handled entity
+         * @details Returns the entity the handle refers to, e.g. to record
+         * changes of it in a command buffer
+         *
+         * @return Handled entity
+         */
+        [[nodiscard]] entt::entity entity() const noexcept;
+
         /**
          * @brief Adds component to handle
          * @details Creates a component of the specific type in
@@ -174,6 +185,41 @@ namespace Coli::Game
             return const_cast<std::remove_cvref_t<T>&>(std::as_const(*this).get<T>());
         }
 
+        /**
+         * @brief Patches component.
+         * @details Calls the functions with the storing component of the
+         * specific type and notifies the observers of the scene about the
+         * change. Use it instead of the mutable @ref get() when the
+         * reactive systems have to process the change.
+         *
+         * @tparam T Type of component to patch;
+         * @tparam Funcs Types of the functions.
+         *
+         * @param funcs Functions to call with the component.
+         *
+         * @throw std::bad_weak_ptr If called on expired handle;
+         * @throw std::invalid_argument If there is no component of T type;
+         * @throw Any Exceptions of the functions.
+         *
+         * @return Reference to the component.
+         */
+        template <class T, class... Funcs>
+            requires (std::invocable<Funcs&, std::remove_cvref_t<T>&> && ...)
+        std::remove_cvref_t<T>& patch(Funcs&&... funcs)
+        {
+            using type = std::remove_cvref_t<T>;
+
+            if (auto const registry = myRegistry.lock()) [[likely]]
+            {
+                if (registry->all_of<type>(myHandle)) [[likely]]
+                    return registry->patch<type>(myHandle, std::forward<Funcs>(funcs)...);
+
+                fail_not_exists();
+            }
+
+            fail_on_expired();
+        }
+
         /**
          * @brief Trying to retrieve component.
          * @details Returns a pointer to the storing component of the specific type
@@ -0,0 +1,269 @@
+#ifndef COLI_GAME_OBJECT_REF_H
+#define COLI_GAME_OBJECT_REF_H
+
+#include "coli/utility.h"
+
+/**
+ * @brief For internal details.
+ * @note The user should not use this namespace.
+ */
+namespace Coli::Game::Detail
+{
+    class COLI_EXPORT SceneTable final
+    {
+    public:
+        static constexpr std::size_t slot_bits = 12;
+        static constexpr std::uint32_t max_scenes = std::uint32_t { 1 } << slot_bits;
+        static constexpr std::uint32_t null = std::numeric_limits<std::uint32_t>::max();
+
+    private:
+        [[noreturn]] static void fail_too_many_scenes();
+
+        struct Entry {
+            std::atomic<std::uint32_t> id { null };
+            std::atomic<entt::registry*> registry { nullptr };
+        };
+
+        [[nodiscard]] static std::array<Entry, max_scenes>& entries() noexcept;
+
+    public:
+        SceneTable() = delete;
+
+        [[nodiscard]] static std::uint32_t acquire(entt::registry& registry);
+        static void release(std::uint32_t id) noexcept;
+
+        [[nodiscard]] static entt::registry* resolve(std::uint32_t id) noexcept;
+    };
+
+    class COLI_EXPORT SceneSlot final
+    {
+    public:
+        SceneSlot() noexcept;
+        explicit SceneSlot(entt::registry& registry);
+
+        SceneSlot(SceneSlot&& other) noexcept;
+        SceneSlot(SceneSlot const&) = delete;
+
+        SceneSlot& operator=(SceneSlot&& other) noexcept;
+        SceneSlot& operator=(SceneSlot const&) = delete;
+
+        ~SceneSlot() noexcept;
+
+        [[nodiscard]] std::uint32_t id() const noexcept;
+
+    private:
+        std::uint32_t myId;
+    };
+}
+
+/// @brief Namespace for the all game-related stuff.
+namespace Coli::Game
+{
+    /**
+     * @brief Compact object reference.
+     * @details Refers to an object by the identifier of its scene and its
+     * entity, 8 bytes in total. The scene is resolved through the global
+     * table of the living scenes, so an access costs a table lookup
+     * instead of locking a weak pointer. The identifiers of the destroyed
+     * scenes are not reused until the table wraps around, so the references
+     * to the objects of the destroyed scenes expire.
+     *
+     * Get it via @ref Scene::ref(). Use @ref SceneAccess to access
+     * the components of many objects of a scene at once.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization. The scene must not be destroyed
+     * while it is accessed through the reference.
+     */
+    class COLI_EXPORT ObjectRef final
+    {
+        [[noreturn]] static void fail_on_expired();
+        [[noreturn]] static void fail_not_exists();
+
+        [[nodiscard]] entt::registry* resolve() const noexcept
+        {
+            auto* const registry = Detail::SceneTable::resolve(myScene);
+            return registry && registry->valid(myEntity) ? registry : nullptr;
+        }
+
+    public:
+        /**
+         * @brief Creates null reference.
+         * @details Creates a reference that is not bound to any object.
+         */
+        ObjectRef() noexcept;
+
+        /**
+         * @brief Creates reference.
+         * @details Creates a reference to the entity of the scene.
+         *
+         * @param scene Identifier of the scene;
+         * @param entity Entity of the object.
+         *
+         * @warning The user should not use this constructor.
+         * You can get the reference in the scene class.
+         */
+        ObjectRef(std::uint32_t scene, entt::entity entity) noexcept;
+
+        /**
+         * @brief Copies reference.
+         * @details Has the default implementation. The reference
+         * is trivially copyable.
+         */
+        ObjectRef(ObjectRef const&) noexcept = default;
+
+        /// @copydoc ObjectRef(ObjectRef const&)
+        ObjectRef& operator=(ObjectRef const&) noexcept = default;
+
+        /// @brief Destroys reference.
+        ~ObjectRef() noexcept = default;
+
+        /**
+         * @brief Compares references.
+         * @details Compares the scenes and the entities.
+         *
+         * @return Whether the references are equal.
+         */
+        [[nodiscard]] friend bool operator==(ObjectRef const&, ObjectRef const&) noexcept = default;
+
+        /**
+         * @brief Returns reference expiration.
+         * @details Checks if the scene or the object is destroyed.
+         *
+         * @return Reference expiration.
+         *
+         * @retval True If the scene or the object is destroyed;
+         * @retval False Otherwise.
+         */
+        [[nodiscard]] bool expired() const noexcept;
+
+        /**
+         * @brief Returns scene identifier.
+         * @details Returns the identifier of the scene of the object.
+         *
+         * @return Identifier of the scene.
+         */
+        [[nodiscard]] std::uint32_t scene() const noexcept;
+
+        /**
+         * @brief Returns referenced entity.
+         * @details Returns the entity the reference refers to.
+         *
+         * @return Referenced entity.
+         */
+        [[nodiscard]] entt::entity entity() const noexcept;
+
+        /**
+         * @brief Adds component.
+         * @details Creates a component of the specific type in
+         * the referenced object.
+         *
+         * @tparam T Type of component to create;
+         * @tparam Args Types of argument passed to the
+         * component constructor.
+         *
+         * @param args Argument passed to the component constructor.
+         *
+         * @throw std::bad_weak_ptr If called on expired reference;
+         * @throw std::bad_alloc If allocation fails;
+         * @throw T Any T(Args...) exception.
+         *
+         * @return Reference to newly created component.
+         */
+        template <class T, class... Args>
+            requires (std::constructible_from<std::remove_cvref_t<T>, Args...>)
+        std::remove_cvref_t<T>& emplace(Args&&... args)
+        {
+            if (auto* const registry = resolve()) [[likely]]
+                return registry->emplace_or_replace<std::remove_cvref_t<T>>(myEntity, std::forward<Args>(args)...);
+
+            fail_on_expired();
+        }
+
+        /**
+         * @brief Retrieves component.
+         * @details Returns the component of the specific type
+         * of the referenced object.
+         *
+         * @tparam T Type of component to get.
+         *
+         * @throw std::bad_weak_ptr If called on expired reference;
+         * @throw std::invalid_argument If there is no component of T type.
+         *
+         * @return Reference to the component.
+         */
+        template <class T>
+        [[nodiscard]] std::remove_cvref_t<T> const& get() const
+        {
+            if (auto* const registry = resolve()) [[likely]]
+            {
+                if (auto const* const component = registry->try_get<std::remove_cvref_t<T>>(myEntity)) [[likely]]
+                    return *component;
+
+                fail_not_exists();
+            }
+
+            fail_on_expired();
+        }
+
+        /// @copydoc get() const
+        template <class T>
+        [[nodiscard]] std::remove_cvref_t<T>& get() {
+            return const_cast<std::remove_cvref_t<T>&>(std::as_const(*this).get<T>());
+        }
+
+        /**
+         * @brief Trying to retrieve component.
+         * @details Returns a pointer to the component of the specific type
+         * of the referenced object.
+         *
+         * @tparam T Type of component to try to get.
+         *
+         * @return Pointer to the component.
+         *
+         * @retval Nullptr If there is no component of this T or the reference is expired;
+         * @retval ValidPointer If a component of T type is found.
+         */
+        template <class T>
+        [[nodiscard]] std::remove_cvref_t<T> const* try_get() const noexcept
+        {
+            if (auto const* const registry = resolve()) [[likely]]
+                return registry->try_get<std::remove_cvref_t<T>>(myEntity);
+
+            return nullptr;
+        }
+
+        /// @copydoc try_get() const
+        template <class T>
+        [[nodiscard]] std::remove_cvref_t<T>* try_get() noexcept {
+            return const_cast<std::remove_cvref_t<T>*>(std::as_const(*this).try_get<T>());
+        }
+
+        /**
+         * @brief Returns component's presence.
+         * @details Checks if the referenced object has a component
+         * of the specific type.
+         *
+         * @tparam T Type of component.
+         *
+         * @return Boolean flag indicating the component presence.
+         *
+         * @retval True If there is a component of T type;
+         * @retval False If there is no component or the reference is expired.
+         */
+        template <class T>
+        [[nodiscard]] bool contains() const noexcept
+        {
+            if (auto* const registry = resolve()) [[likely]]
+                return registry->all_of<std::remove_cvref_t<T>>(myEntity);
+
+            return false;
+        }
+
+    private:
+        std::uint32_t myScene;
+        entt::entity myEntity;
+    };
+}
+
+#endif
@@ -0,0 +1,232 @@
+#ifndef COLI_GAME_OBSERVER_H
+#define COLI_GAME_OBSERVER_H
+
+#include "coli/utility.h"
+#include "coli/game/scene.h"
+#include "coli/generic/worker_pool.h"
+
+/// @brief Namespace for the all game-related stuff.
+namespace Coli::Game
+{
+    /**
+     * @brief Changes observer.
+     * @details Collects the objects of a scene whose components of the
+     * observed types were added, replaced or patched, e.g. via
+     * @ref ObjectHandle::patch(). Each object is collected once until the
+     * observer is cleared. Objects that lose an observed component are
+     * dropped. The objects that already have all the observed components
+     * are collected on creation.
+     *
+     * Changes made through the mutable references, e.g. the mutable
+     * @ref ObjectHandle::get(), are not observed.
+     *
+     * The changes made by the worker pool threads are recorded into the
+     * buffers of their slots, so the threads may change the observed
+     * components at the same time. They are added to the collected
+     * objects by @ref collect().
+     *
+     * @tparam Types Observed components.
+     *
+     * @note Not thread-safe. Concurrent access requires external
+     * synchronization. The observed components may be changed at the same
+     * time only by the threads of different worker pool slots, and not
+     * while the observer is accessed.
+     */
+    template <class... Types>
+        requires (sizeof...(Types) > 0)
+    class COLI_EXPORT Observer final
+    {
+        struct alignas(Utility::cache_line_size) Slot {
+            std::vector<entt::entity> changed;
+        };
+
+        void on_change(entt::registry&, entt::entity const entity)
+        {
+            auto const slot = Generic::WorkerPool::current_slot(mySize);
+
+            if (slot != 0)
+                mySlots[slot].changed.push_back(entity);
+            else if (!myChanged.contains(entity))
+                myChanged.push(entity);
+        }
+
+        void on_destroy(entt::registry&, entt::entity const entity) {
+            myChanged.remove(entity);
+        }
+
+    public:
+        /**
+         * @brief Creates observer.
+         * @details Starts observing the scene. Changes made by the threads
+         * of the slots out of the count throw std::out_of_range.
+         *
+         * @param scene Scene to observe;
+         * @param slots Count of the worker pool slots to record changes for.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        explicit Observer(Scene& scene, std::size_t const slots = 1) :
+            myRegistry (scene.myRegistry),
+            myObserved (scene.myRegistry.get()),
+            mySlots    (std::make_unique<Slot[]>(std::max<std::size_t>(slots, 1))),
+            mySize     (std::max<std::size_t>(slots, 1))
+        {
+            auto& registry = *scene.myRegistry;
+
+            ((registry.template on_construct<std::remove_cvref_t<Types>>().template connect<&Observer::on_change>(*this),
+              registry.template on_update<std::remove_cvref_t<Types>>().template connect<&Observer::on_change>(*this),
+              registry.template on_destroy<std::remove_cvref_t<Types>>().template connect<&Observer::on_destroy>(*this)), ...);
+
+            for (auto const entity : registry.template view<std::remove_cvref_t<Types> const...>())
+                myChanged.push(entity);
+        }
+
+        Observer(Observer&&) = delete;
+        Observer(Observer const&) = delete;
+
+        Observer& operator=(Observer&&) = delete;
+        Observer& operator=(Observer const&) = delete;
+
+        /**
+         * @brief Destroys observer.
+         * @details Stops observing the scene if it still exists.
+         */
+        ~Observer() noexcept
+        {
+            if (auto const registry = myRegistry.lock())
+                ((registry->template on_construct<std::remove_cvref_t<Types>>().disconnect(*this),
+                  registry->template on_update<std::remove_cvref_t<Types>>().disconnect(*this),
+                  registry->template on_destroy<std::remove_cvref_t<Types>>().disconnect(*this)), ...);
+        }
+
+        /**
+         * @brief Checks observed scene.
+         * @details Checks the observer observes the scene.
+         *
+         * @param scene Scene to check.
+         *
+         * @return Checking result.
+         *
+         * @retval True If the scene is observed;
+         * @retval False Otherwise.
+         */
+        [[nodiscard]] bool observes(Scene const& scene) const noexcept {
+            return myObserved == scene.myRegistry.get() && !myRegistry.expired();
+        }
+
+        /**
+         * @brief Returns slots count.
+         * @details Returns the count of the worker pool slots
+         * the changes are recorded for.
+         *
+         * @return Count of the slots.
+         */
+        [[nodiscard]] std::size_t slot_count() const noexcept {
+            return mySize;
+        }
+
+        /**
+         * @brief Resizes slots.
+         * @details Collects the changes and changes the count of the
+         * worker pool slots the changes are recorded for.
+         *
+         * @param slots Count of the worker pool slots to record changes for.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void resize(std::size_t const slots)
+        {
+            auto const size = std::max<std::size_t>(slots, 1);
+            auto newSlots = std::make_unique<Slot[]>(size);
+
+            collect();
+
+            mySlots = std::move(newSlots);
+            mySize = size;
+        }
+
+        /**
+         * @brief Collects changes.
+         * @details Adds the objects changed by the worker pool threads to
+         * the collected ones. The objects that no longer have all the
+         * observed components are dropped. Changes made by the threads of
+         * the 0 slot are collected immediately.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void collect()
+        {
+            auto const registry = myRegistry.lock();
+
+            for (std::size_t i = 1; i < mySize; ++i)
+            {
+                auto& changed = mySlots[i].changed;
+
+                if (registry)
+                    for (auto const entity : changed)
+                        if (!myChanged.contains(entity) && registry->valid(entity) &&
+                            registry->template all_of<std::remove_cvref_t<Types>...>(entity))
+                            myChanged.push(entity);
+
+                changed.clear();
+            }
+        }
+
+        /**
+         * @brief Returns changed objects.
+         * @details Returns the entities collected since the last clear.
+         * The entities may no longer have all the observed components.
+         *
+         * @return Span of the changed entities.
+         */
+        [[nodiscard]] std::span<entt::entity const> changed() const noexcept {
+            return { myChanged.data(), myChanged.size() };
+        }
+
+        /**
+         * @brief Returns changed objects count.
+         * @details Returns the count of the entities collected
+         * since the last clear.
+         *
+         * @return Count of the changed entities.
+         */
+        [[nodiscard]] std::size_t size() const noexcept {
+            return myChanged.size();
+        }
+
+        /**
+         * @brief Checks there are no changes.
+         * @details Checks no entities were collected since the last clear.
+         *
+         * @return Checking result.
+         *
+         * @retval True If there are no changed entities;
+         * @retval False Otherwise.
+         */
+        [[nodiscard]] bool empty() const noexcept {
+            return myChanged.empty();
+        }
+
+        /**
+         * @brief Clears changes.
+         * @details Forgets the collected entities and the changes
+         * not collected yet.
+         */
+        void clear() noexcept
+        {
+            myChanged.clear();
+
+            for (std::size_t i = 0; i < mySize; ++i)
+                mySlots[i].changed.clear();
+        }
+
+    private:
+        std::weak_ptr<entt::registry> myRegistry;
+        entt::registry const* myObserved;
+        entt::sparse_set myChanged;
+        std::unique_ptr<Slot[]> mySlots;
+        std::size_t mySize;
+    };
+}
+
+#endif
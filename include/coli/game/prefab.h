@@ -0,0 +1,316 @@
+#ifndef COLI_GAME_PREFAB_H
+#define COLI_GAME_PREFAB_H
+
+#include "coli/utility.h"
+#include "coli/game/scene.h"
+#include "coli/game/scene_access.h"
+
+/**
+ * @brief For internal details.
+ * @note The user should not use this namespace.
+ */
+namespace Coli::Game::Detail
+{
+    class COLI_EXPORT PrefabComponentBase
+    {
+    public:
+        virtual ~PrefabComponentBase() noexcept = default;
+
+        [[nodiscard]] virtual std::unique_ptr<PrefabComponentBase> clone() const = 0;
+        virtual void instantiate(Scene& scene, std::span<entt::entity const> entities) const = 0;
+    };
+
+    template <std::copy_constructible T>
+    class PrefabComponent final :
+        public PrefabComponentBase
+    {
+    public:
+        template <class... Args>
+        explicit PrefabComponent(std::in_place_t, Args&&... args) :
+            myValue (std::forward<Args>(args)...)
+        {}
+
+        [[nodiscard]] T& value() noexcept {
+            return myValue;
+        }
+
+        [[nodiscard]] T const& value() const noexcept {
+            return myValue;
+        }
+
+        [[nodiscard]] std::unique_ptr<PrefabComponentBase> clone() const override {
+            return std::make_unique<PrefabComponent>(std::in_place, myValue);
+        }
+
+        void instantiate(Scene& scene, std::span<entt::entity const> const entities) const override
+        {
+            auto* const storage = scene.storage<T>();
+            storage->reserve(storage->size() + entities.size());
+
+            scene.insert<T>(entities, myValue);
+        }
+
+    private:
+        T myValue;
+    };
+}
+
+/// @brief Namespace for the all game-related stuff.
+namespace Coli::Game
+{
+    /**
+     * @brief Prefab class.
+     * @details Captures a set of components with their values once and
+     * instantiates any count of objects with copies of them. The objects
+     * are created in bulk, and the components are inserted one type at
+     * a time into the storages reserved up front, so an instantiation
+     * makes no per-object lookups. The components that are trivially
+     * copyable, e.g. @ref Components::Layer and the transforms, are
+     * copied as plain memory.
+     *
+     * The values that differ between the instances are set by an override
+     * callback after the copies are inserted.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT Prefab final
+    {
+        using components_entry = std::pair<entt::id_type, std::unique_ptr<Detail::PrefabComponentBase>>;
+
+        [[noreturn]] static void fail_not_exists();
+
+        template <class T>
+        [[nodiscard]] Detail::PrefabComponent<T> const* find() const noexcept
+        {
+            auto const id = entt::type_hash<T>::value();
+            auto const place = std::ranges::lower_bound(myComponents, id, {}, &components_entry::first);
+
+            if (place != myComponents.end() && place->first == id)
+                return static_cast<Detail::PrefabComponent<T> const*>(place->second.get());
+
+            return nullptr;
+        }
+
+    public:
+        /**
+         * @brief Creates prefab.
+         * @details Creates a prefab without components.
+         */
+        Prefab() noexcept;
+
+        /**
+         * @brief Copies prefab.
+         * @details Copies the components of the other prefab.
+         *
+         * @param other Other prefab.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw Any Exceptions of the component copy constructors.
+         */
+        Prefab(Prefab const& other);
+
+        /**
+         * @brief Moves prefab.
+         * @details Just moves the components.
+         *
+         * @param other Other prefab.
+         */
+        Prefab(Prefab&& other) noexcept;
+
+        /// @copydoc Prefab(Prefab const&)
+        Prefab& operator=(Prefab const& other);
+
+        /// @copydoc Prefab(Prefab&&)
+        Prefab& operator=(Prefab&& other) noexcept;
+
+        /// @brief Destroys prefab.
+        ~Prefab() noexcept;
+
+        /**
+         * @brief Adds component.
+         * @details Captures a component of the specific type, replacing
+         * the one the prefab already has.
+         *
+         * @tparam T Type of component to capture;
+         * @tparam Args Types of argument passed to the
+         * component constructor.
+         *
+         * @param args Argument passed to the component constructor.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw T Any T(Args...) exception.
+         *
+         * @return Reference to the captured component.
+         */
+        template <class T, class... Args>
+            requires (std::constructible_from<std::remove_cvref_t<T>, Args...> &&
+                std::copy_constructible<std::remove_cvref_t<T>>)
+        std::remove_cvref_t<T>& emplace(Args&&... args)
+        {
+            using component_type = std::remove_cvref_t<T>;
+
+            auto component = std::make_unique<Detail::PrefabComponent<component_type>>(
+                std::in_place, std::forward<Args>(args)...);
+
+            auto& value = component->value();
+
+            auto const id = entt::type_hash<component_type>::value();
+            auto const place = std::ranges::lower_bound(myComponents, id, {}, &components_entry::first);
+
+            if (place != myComponents.end() && place->first == id)
+                place->second = std::move(component);
+            else
+                myComponents.emplace(place, id, std::move(component));
+
+            return value;
+        }
+
+        /**
+         * @brief Retrieves component.
+         * @details Returns the captured component of the specific type.
+         *
+         * @tparam T Type of component to get.
+         *
+         * @throw std::invalid_argument If there is no component of T type.
+         *
+         * @return Reference to the component.
+         */
+        template <class T>
+        [[nodiscard]] std::remove_cvref_t<T> const& get() const
+        {
+            if (auto const* const component = find<std::remove_cvref_t<T>>()) [[likely]]
+                return component->value();
+
+            fail_not_exists();
+        }
+
+        /// @copydoc get() const
+        template <class T>
+        [[nodiscard]] std::remove_cvref_t<T>& get() {
+            return const_cast<std::remove_cvref_t<T>&>(std::as_const(*this).get<T>());
+        }
+
+        /**
+         * @brief Returns component's presence.
+         * @details Checks if the prefab has a component of the specific type.
+         *
+         * @tparam T Type of component.
+         *
+         * @return Boolean flag indicating the component presence.
+         *
+         * @retval True If there is a component of T type;
+         * @retval False Otherwise.
+         */
+        template <class T>
+        [[nodiscard]] bool contains() const noexcept {
+            return find<std::remove_cvref_t<T>>() != nullptr;
+        }
+
+        /**
+         * @brief Removes component.
+         * @details Removes the component of the specific type if it exists.
+         *
+         * @tparam T Type of component to remove.
+         */
+        template <class T>
+        void destroy() noexcept
+        {
+            auto const id = entt::type_hash<std::remove_cvref_t<T>>::value();
+            auto const place = std::ranges::lower_bound(myComponents, id, {}, &components_entry::first);
+
+            if (place != myComponents.end() && place->first == id)
+                myComponents.erase(place);
+        }
+
+        /**
+         * @brief Returns components count.
+         * @details Returns the count of the captured components.
+         *
+         * @return Count of the components.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * @brief Checks components.
+         * @details Checks if the prefab has no components.
+         *
+         * @return Whether the prefab is empty.
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Clears prefab.
+         * @details Removes all the components.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Instantiates prefab.
+         * @details Creates an object for every element of the span, writes
+         * the entities into it and inserts the copies of the components
+         * into all of them at once, one type at a time.
+         *
+         * @param scene Scene to create the objects in;
+         * @param entities Span to write the created entities to.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw Any Exceptions of the component copy constructors.
+         */
+        void instantiate(Scene& scene, std::span<entt::entity> entities) const;
+
+        /**
+         * @brief Instantiates prefab.
+         * @details Creates the specific count of objects with the copies
+         * of the components.
+         *
+         * @param scene Scene to create the objects in;
+         * @param count Count of objects to create.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw Any Exceptions of the component copy constructors.
+         *
+         * @return Created entities.
+         */
+        [[nodiscard]] std::vector<entt::entity> instantiate(Scene& scene, std::size_t count) const;
+
+        /**
+         * @brief Instantiates prefab with overrides.
+         * @details Creates the specific count of objects with the copies
+         * of the components, then calls the override callback for every
+         * object with the access to the scene, the entity of the object and
+         * its index among the created ones. The observers are notified of
+         * the inserted components before the overrides are applied.
+         *
+         * @tparam Func Type of the override callback.
+         *
+         * @param scene Scene to create the objects in;
+         * @param count Count of objects to create;
+         * @param func Override callback.
+         *
+         * @throw std::bad_weak_ptr If the scene is not valid;
+         * @throw std::bad_alloc If allocation fails;
+         * @throw Any Exceptions of the component copy constructors
+         * and the callback.
+         *
+         * @return Created entities.
+         */
+        template <class Func>
+            requires (std::invocable<Func&, SceneAccess&, entt::entity, std::size_t>)
+        std::vector<entt::entity> instantiate(Scene& scene, std::size_t const count, Func&& func) const
+        {
+            SceneAccess access { scene };
+            auto entities = instantiate(scene, count);
+
+            for (std::size_t i = 0; i < entities.size(); ++i)
+                std::invoke(func, access, entities[i], i);
+
+            return entities;
+        }
+
+    private:
+        std::vector<components_entry> myComponents;
+    };
+}
+
+#endif
@@ -3,6 +3,22 @@
 
 #include "coli/utility.h"
 #include "coli/game/object.h"
+#include "coli/game/object_ref.h"
+#include "coli/game/components/double_buffered.h"
+#include "coli/game/components/layer.h"
+
+/**
+ * @brief For internal details.
+ * @note The user should not use this namespace.
+ */
+namespace Coli::Game::Detail
+{
+    template <class Range>
+    concept entity_range =
+        std::ranges::forward_range<Range> &&
+        std::ranges::common_range<Range> &&
+        std::same_as<std::ranges::range_value_t<Range>, entt::entity>;
+}
 
 /// @brief Namespace for the all game-related stuff.
 namespace Coli::Game
@@ -16,6 +32,62 @@ namespace Coli::Game
     */
     class COLI_EXPORT Scene final
     {
+        struct Reservations;
+        struct Group;
+
+        using buffers_entry = std::pair<entt::id_type, std::unique_ptr<Detail::BufferState>>;
+
+        [[noreturn]] static void fail_size_mismatch();
+        [[noreturn]] static void fail_owned();
+        [[noreturn]] static void fail_sorted_owned();
+
+        [[nodiscard]] bool known_group(entt::id_type type) const noexcept;
+
+        void own(
+            entt::id_type type,
+            std::initializer_list<entt::id_type> owned,
+            std::initializer_list<entt::id_type> get,
+            std::initializer_list<entt::id_type> excluded);
+
+        [[nodiscard]] bool owned(entt::id_type id) const noexcept;
+        [[nodiscard]] Detail::LayerOrder* find_layer_order() noexcept;
+        [[nodiscard]] Detail::LayerOrder& layer_order();
+
+        template <class T>
+        void order_by_layer(Detail::LayerOrder& order)
+        {
+            auto const id = entt::type_hash<T>::value();
+
+            if (order.sorts(id))
+                return;
+
+            if (owned(id))
+                fail_sorted_owned();
+
+            order.depend(id, [] (entt::registry& registry) {
+                registry.sort<T, Components::Layer>();
+            });
+
+            // Adding and removing the components breaks the order of the storage.
+            myRegistry->on_construct<T>().template connect<&Detail::LayerOrder::touch>(order);
+            myRegistry->on_destroy<T>().template connect<&Detail::LayerOrder::touch>(order);
+        }
+
+        void create_reserved();
+        void created(entt::id_type next) noexcept;
+
+        template <class T>
+        static void bind_buffer(Detail::BufferState& state, entt::registry& registry, entt::entity const entity) {
+            registry.get<Components::DoubleBuffered<T>>(entity).myState = std::addressof(state);
+        }
+
+        friend class CommandBuffer;
+        friend class SceneAccess;
+
+        template <class... Types>
+            requires (sizeof...(Types) > 0)
+        friend class Observer;
+
     public:
         /**
          * @brief Creates scene.
@@ -65,6 +137,15 @@ namespace Coli::Game
          */
         [[nodiscard]] bool is_valid() const noexcept;
 
+        /**
+         * @brief Returns scene identifier.
+         * @details Returns the identifier of the scene in the table of
+         * the living scenes. It is kept when the scene is moved.
+         *
+         * @return Identifier of the scene.
+         */
+        [[nodiscard]] std::uint32_t id() const noexcept;
+
         /**
          * @brief Creates entity in scene.
          * @details Creates an entity inside the scene and returns a
@@ -76,6 +157,171 @@ namespace Coli::Game
          */
         [[nodiscard]] ObjectHandle create();
 
+        /**
+         * @brief Creates entities in scene.
+         * @details Creates an entity for every element of the range
+         * and writes the entities into it, all at once. No handles are
+         * created, get them via @ref handle() or @ref ref() if needed.
+         *
+         * @tparam Range Type of the range of entities.
+         *
+         * @param entities Range to write the created entities to.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        template <Detail::entity_range Range>
+        void create_many(Range&& entities)
+        {
+            create_reserved();
+
+            auto const first = std::ranges::begin(entities);
+            auto const last = std::ranges::end(entities);
+
+            if (first == last)
+                return;
+
+            myRegistry->create(first, last);
+
+            auto const max = std::ranges::max(entities, {}, [] (entt::entity const entity) {
+                return entt::to_entity(entity);
+            });
+
+            created(entt::to_entity(max) + 1);
+        }
+
+        /**
+         * @brief Creates entities in scene.
+         * @details Creates the specific count of entities at once.
+         * No handles are created.
+         *
+         * @param count Count of entities to create.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Created entities.
+         */
+        [[nodiscard]] std::vector<entt::entity> create_many(std::size_t count);
+
+        /**
+         * @brief Returns handle.
+         * @details Returns the handle to the entity of the scene. It is
+         * not checked that the entity is alive.
+         *
+         * @param entity Entity of the object.
+         *
+         * @return Handle to the object.
+         */
+        [[nodiscard]] ObjectHandle handle(entt::entity entity) const noexcept;
+
+        /**
+         * @brief Reserves components.
+         * @details Reserves the storages of the components of the specific
+         * types for the count of objects, so the following insertions do
+         * not reallocate them.
+         *
+         * @tparam Types Types of the components.
+         *
+         * @param count Count of objects.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        template <class... Types>
+            requires (sizeof...(Types) > 0)
+        void reserve(std::size_t const count) {
+            (myRegistry->storage<std::remove_cvref_t<Types>>().reserve(count), ...);
+        }
+
+        /**
+         * @brief Inserts components.
+         * @details Adds a copy of the component to every entity of the range
+         * at once. The entities must exist and must not have a component
+         * of this type.
+         *
+         * @tparam T Type of the component;
+         * @tparam Range Type of the range of entities.
+         *
+         * @param entities Entities to add the components to;
+         * @param value Value of the components.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw T Any of T(T const&) constructor exceptions.
+         */
+        template <class T, Detail::entity_range Range>
+        void insert(Range&& entities, std::remove_cvref_t<T> const& value = {}) {
+            myRegistry->insert<std::remove_cvref_t<T>>(std::ranges::begin(entities), std::ranges::end(entities), value);
+        }
+
+        /**
+         * @brief Inserts components.
+         * @details Adds the components of the range to the entities of
+         * the other range at once, in the same order. The entities must
+         * exist and must not have a component of this type.
+         *
+         * @tparam T Type of the component;
+         * @tparam Range Type of the range of entities;
+         * @tparam Components Type of the range of components.
+         *
+         * @param entities Entities to add the components to;
+         * @param components Components to add, e.g. a span.
+         *
+         * @throw std::invalid_argument If the ranges have different sizes;
+         * @throw std::bad_alloc If allocation fails;
+         * @throw T Any of T constructor exceptions.
+         */
+        template <class T, Detail::entity_range Range, std::ranges::input_range Components>
+            requires (std::ranges::sized_range<Range> && std::ranges::sized_range<Components> &&
+                std::same_as<std::ranges::range_value_t<Components>, std::remove_cvref_t<T>>)
+        void insert(Range&& entities, Components&& components)
+        {
+            if (std::ranges::size(entities) != std::ranges::size(components))
+                fail_size_mismatch();
+
+            myRegistry->insert<std::remove_cvref_t<T>>(
+                std::ranges::begin(entities), std::ranges::end(entities), std::ranges::begin(components));
+        }
+
+        /**
+         * @brief Generates components.
+         * @details Adds the components returned by the generator for each
+         * entity of the range at once. The entities must exist and must
+         * not have a component of this type.
+         *
+         * @tparam T Type of the component;
+         * @tparam Range Type of the range of entities;
+         * @tparam Func Type of the generator.
+         *
+         * @param entities Entities to add the components to;
+         * @param func Generator called with every entity.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw Any Exceptions of the generator.
+         */
+        template <class T, Detail::entity_range Range, class Func>
+            requires (std::ranges::sized_range<Range> &&
+                std::convertible_to<std::invoke_result_t<Func&, entt::entity>, std::remove_cvref_t<T>>)
+        void generate(Range&& entities, Func&& func)
+        {
+            auto generated = entities | std::views::transform([&func] (entt::entity const entity) -> std::remove_cvref_t<T> {
+                return std::invoke(func, entity);
+            });
+
+            myRegistry->insert<std::remove_cvref_t<T>>(
+                std::ranges::begin(entities), std::ranges::end(entities), generated.begin());
+        }
+
+        /**
+         * @brief Reserves entity.
+         * @details Reserves an identifier of an entity without creating it.
+         * The entity is created by the next structural change of the scene,
+         * e.g. @ref create() or a command buffer flush.
+         *
+         * @return Reserved entity.
+         *
+         * @note Thread-safe with the other reservations, but not with
+         * the structural changes of the scene.
+         */
+        [[nodiscard]] entt::entity reserve() noexcept;
+
         /**
          * @brief Destroys entity in scene.
          * @details Destroys the entity inside the scene handled
@@ -85,6 +331,28 @@ namespace Coli::Game
          */
         void destroy(ObjectHandle const& handle) noexcept;
 
+        /**
+         * @brief Returns compact reference.
+         * @details Returns the compact reference to the entity of
+         * the scene. It is not checked that the entity is alive.
+         *
+         * @param entity Entity of the object.
+         *
+         * @return Reference to the object.
+         */
+        [[nodiscard]] ObjectRef ref(entt::entity entity) const noexcept;
+
+        /**
+         * @brief Returns compact reference.
+         * @details Returns the compact reference to the object
+         * of the handle.
+         *
+         * @param handle Handle to the object.
+         *
+         * @return Reference to the object.
+         */
+        [[nodiscard]] ObjectRef ref(ObjectHandle const& handle) const noexcept;
+
         /**
          * @brief Returns view to filtered.
          * @details Filters all storing objects and returns view
@@ -107,8 +375,213 @@ namespace Coli::Game
             return myRegistry->view<Types...>();
         }
 
+        /**
+         * @brief Returns view to filtered with exclusions.
+         * @details Filters all storing objects and returns view
+         * to the objects that has required components and has
+         * none of the excluded ones. The excluded objects are
+         * skipped by the view itself.
+         *
+         * @tparam Types Required components;
+         * @tparam Excluded Excluded components.
+         *
+         * @param exclude Exclusion list, e.g. `entt::exclude<Dead>`.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return View to filtered objects.
+         */
+        template <class... Types, class... Excluded>
+            requires (sizeof...(Types) > 0)
+        [[nodiscard]] auto filtered(entt::exclude_t<Excluded...> exclude) const {
+            return myRegistry->view<std::add_const_t<Types>...>(exclude);
+        }
+
+        /// @copydoc filtered(entt::exclude_t<Excluded...>) const
+        template <class... Types, class... Excluded>
+            requires (sizeof...(Types) > 0)
+        [[nodiscard]] auto filtered(entt::exclude_t<Excluded...> exclude) {
+            return myRegistry->view<Types...>(exclude);
+        }
+
+        /**
+         * @brief Returns owning group.
+         * @details Returns the group of the objects that have all the owned
+         * and the got components and none of the excluded ones, creating it
+         * if missing. The group owns the storages of the owned components:
+         * it keeps its objects packed at their front in the same order, so
+         * the group is iterated as parallel arrays without probing the
+         * storages for every object. The cost is paid when the components
+         * are added and removed.
+         *
+         * A component may be owned by a single group only. The scene detects
+         * the conflicts and throws when a group owns a component that is
+         * already owned by another group, i.e. one with other owned, got or
+         * excluded components. Requesting the same group again returns it.
+         * The components sorted by @ref keep_layer_order() may not be owned
+         * either, since the group and the sort would break each other's order.
+         *
+         * @tparam Owned Owned components;
+         * @tparam Get Got components;
+         * @tparam Excluded Excluded components.
+         *
+         * @param get List of the got components, e.g. `entt::get<Health>`;
+         * @param exclude Exclusion list, e.g. `entt::exclude<Dead>`.
+         *
+         * @throw std::invalid_argument If an owned component is already
+         * owned by another group or sorted by layer;
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Owning group.
+         */
+        template <class... Owned, class... Get, class... Excluded>
+            requires (sizeof...(Owned) > 0)
+        [[nodiscard]] auto grouped(
+            entt::get_t<Get...> get = entt::get_t<Get...> {},
+            entt::exclude_t<Excluded...> exclude = entt::exclude_t<Excluded...> {})
+        {
+            using group_type = decltype(myRegistry->group<Owned...>(get, exclude));
+
+            // The conflicts are checked once per group type. Later calls only
+            // look the type up, so the systems may call it on every frame.
+            if (auto const type = entt::type_hash<group_type>::value(); !known_group(type))
+                own(type,
+                    { entt::type_hash<std::remove_cvref_t<Owned>>::value()... },
+                    { entt::type_hash<std::remove_cvref_t<Get>>::value()... },
+                    { entt::type_hash<std::remove_cvref_t<Excluded>>::value()... });
+
+            return myRegistry->group<Owned...>(get, exclude);
+        }
+
+        /**
+         * @brief Keeps layer order.
+         * @details Keeps the storage of the layer components sorted by the
+         * layer values, and the storages of the dependent components sorted
+         * in the same order. A view of the layers and the dependents is
+         * then iterated in the layer order, whichever storage leads it,
+         * without sorting it. The objects that have a dependent component
+         * but no layer are iterated in an unspecified order.
+         *
+         * The order is updated by @ref update_layer_order(), which the engine
+         * calls before the systems of every frame. It sorts the storages only
+         * if a layer component was added, replaced, patched or removed, or
+         * viewed as non-const by a system, or a dependent component was
+         * added or removed. The sort is an insertion sort, so it is close to
+         * linear when few objects moved, and a full stable sort when many
+         * did, so the objects of equal layers keep their order either way.
+         * Out of the systems, change the layers via `patch()` or `emplace()`,
+         * since an assignment to the component itself goes unnoticed.
+         *
+         * Call it again to add dependents. The sorted components may not be
+         * owned by a group, see @ref grouped().
+         *
+         * @tparam Dependents Types of the dependent components.
+         *
+         * @throw std::invalid_argument If a sorted component is owned by
+         * a group;
+         * @throw std::bad_alloc If allocation fails.
+         */
+        template <class... Dependents>
+        void keep_layer_order()
+        {
+            auto& order = layer_order();
+            (order_by_layer<std::remove_cvref_t<Dependents>>(order), ...);
+
+            update_layer_order();
+        }
+
+        /**
+         * @brief Updates layer order.
+         * @details Sorts the storages of the layer and the dependent
+         * components if their order may have changed since the last update.
+         * Does nothing if the order is not kept.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Whether the storages were sorted.
+         */
+        bool update_layer_order();
+
+        /**
+         * @brief Marks layer order.
+         * @details Makes the next @ref update_layer_order() sort the storages
+         * if the order is kept. Used by the systems that write the layer
+         * components directly.
+         *
+         * @note The user should not use this method.
+         */
+        void touch_layer_order() noexcept;
+
+        /**
+         * @brief Returns buffer state.
+         * @details Returns the state of the double-buffered components
+         * of the specific type, creating it if missing.
+         *
+         * @tparam T Type of the state of the double-buffered components.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Reference to the buffer state.
+         *
+         * @note The user should not use this method.
+         */
+        template <class T>
+        [[nodiscard]] Detail::BufferState& buffer()
+        {
+            using component_type = Components::DoubleBuffered<T>;
+
+            // The states are owned by the registry, since its components point
+            // to them and it may outlive the scene in a scene access.
+            auto& buffers = myRegistry->ctx().template emplace<std::vector<buffers_entry>>();
+
+            auto const id = entt::type_hash<T>::value();
+            auto place = std::ranges::lower_bound(buffers, id, {}, &buffers_entry::first);
+
+            if (place != buffers.end() && place->first == id)
+                return *place->second;
+
+            place = buffers.emplace(place, id, std::make_unique<Detail::BufferState>());
+            auto& state = *place->second;
+
+            myRegistry->on_construct<component_type>().template connect<&Scene::bind_buffer<T>>(state);
+            myRegistry->view<component_type>().each([&state] (component_type& component) {
+                component.myState = std::addressof(state);
+            });
+
+            return state;
+        }
+
+        /**
+         * @brief Swaps buffers.
+         * @details Swaps the buffers of the double-buffered components of
+         * every type whose back buffers were written since the last swap.
+         * The engine calls it after the systems of every frame.
+         */
+        void swap_buffers() noexcept;
+
+        /**
+         * @brief Returns component storage.
+         * @details Returns the storage of the components of the specific
+         * type, creating it if missing. Look the optional components up
+         * in it instead of searching for the storage for every object.
+         *
+         * @tparam T Type of the component.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Pointer to the storage.
+         */
+        template <class T>
+        [[nodiscard]] auto* storage() {
+            return std::addressof(myRegistry->storage<std::remove_cvref_t<T>>());
+        }
+
     private:
         std::shared_ptr<entt::registry> myRegistry;
+        Detail::SceneSlot mySlot;
+        std::unique_ptr<Reservations> myReservations;
+        std::vector<Group> myGroups;
+        std::vector<entt::id_type> myGroupTypes;
     };
 }
 
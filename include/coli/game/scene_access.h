@@ -0,0 +1,182 @@
+#ifndef COLI_GAME_SCENE_ACCESS_H
+#define COLI_GAME_SCENE_ACCESS_H
+
+#include "coli/utility.h"
+#include "coli/game/object.h"
+#include "coli/game/object_ref.h"
+#include "coli/game/scene.h"
+
+/// @brief Namespace for the all game-related stuff.
+namespace Coli::Game
+{
+    /**
+     * @brief Scoped scene access.
+     * @details Resolves the scene once on creation and keeps it alive while
+     * the access exists, unless it is created from a reference. The
+     * components of the objects are then accessed without checking the
+     * scene, so the calls are cheap enough to be inlined into the loops
+     * over many objects. Create it for a batch of
+     * handles or references of one scene instead of accessing each of them
+     * on its own.
+     *
+     * The objects are not checked either. Check them with @ref valid()
+     * if they may have been destroyed.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT SceneAccess final
+    {
+        [[noreturn]] static void fail_on_expired();
+
+    public:
+        /**
+         * @brief Creates scene access.
+         * @details Creates the access to the scene and keeps the objects
+         * of the scene alive while the access exists, even if the scene
+         * is reset.
+         *
+         * @param scene Scene to access.
+         *
+         * @throw std::bad_weak_ptr If the scene is not valid.
+         */
+        explicit SceneAccess(Scene& scene);
+
+        /**
+         * @brief Creates scene access.
+         * @details Locks the scene of the handle once and keeps it
+         * alive while the access exists.
+         *
+         * @param handle Handle to an object of the scene.
+         *
+         * @throw std::bad_weak_ptr If the scene is destroyed.
+         */
+        explicit SceneAccess(ObjectHandle const& handle);
+
+        /**
+         * @brief Creates scene access.
+         * @details Resolves the scene of the reference once. Does not keep
+         * the scene alive, so the scene must not be destroyed while
+         * the access exists.
+         *
+         * @param ref Reference to an object of the scene.
+         *
+         * @throw std::bad_weak_ptr If the scene is destroyed.
+         */
+        explicit SceneAccess(ObjectRef const& ref);
+
+        SceneAccess(SceneAccess&&) = delete;
+        SceneAccess(SceneAccess const&) = delete;
+
+        SceneAccess& operator=(SceneAccess&&) = delete;
+        SceneAccess& operator=(SceneAccess const&) = delete;
+
+        /**
+         * @brief Destroys scene access.
+         * @details Releases the scene.
+         */
+        ~SceneAccess() noexcept;
+
+        /**
+         * @brief Checks object.
+         * @details Checks if the object exists in the scene.
+         *
+         * @param entity Entity of the object.
+         *
+         * @return Whether the object exists.
+         */
+        [[nodiscard]] bool valid(entt::entity const entity) const noexcept {
+            return myRegistry->valid(entity);
+        }
+
+        /**
+         * @brief Adds component.
+         * @details Creates a component of the specific type in the object,
+         * or replaces the existing one.
+         *
+         * @tparam T Type of component to create;
+         * @tparam Args Types of argument passed to the
+         * component constructor.
+         *
+         * @param entity Entity of the object. It must exist;
+         * @param args Argument passed to the component constructor.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw T Any T(Args...) exception.
+         *
+         * @return Reference to the component.
+         */
+        template <class T, class... Args>
+            requires (std::constructible_from<std::remove_cvref_t<T>, Args...>)
+        std::remove_cvref_t<T>& emplace(entt::entity const entity, Args&&... args) {
+            return myRegistry->emplace_or_replace<std::remove_cvref_t<T>>(entity, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Retrieves component.
+         * @details Returns the component of the specific type of the object.
+         *
+         * @tparam T Type of component to get.
+         *
+         * @param entity Entity of the object. It must have the component.
+         *
+         * @return Reference to the component.
+         */
+        template <class T>
+        [[nodiscard]] std::remove_cvref_t<T> const& get(entt::entity const entity) const noexcept {
+            return std::as_const(*myRegistry).template get<std::remove_cvref_t<T>>(entity);
+        }
+
+        /// @copydoc get(entt::entity) const
+        template <class T>
+        [[nodiscard]] std::remove_cvref_t<T>& get(entt::entity const entity) noexcept {
+            return myRegistry->get<std::remove_cvref_t<T>>(entity);
+        }
+
+        /**
+         * @brief Trying to retrieve component.
+         * @details Returns a pointer to the component of the specific type
+         * of the object.
+         *
+         * @tparam T Type of component to try to get.
+         *
+         * @param entity Entity of the object. It must exist.
+         *
+         * @return Pointer to the component.
+         *
+         * @retval Nullptr If there is no component of this T;
+         * @retval ValidPointer If a component of T type is found.
+         */
+        template <class T>
+        [[nodiscard]] std::remove_cvref_t<T> const* try_get(entt::entity const entity) const noexcept {
+            return std::as_const(*myRegistry).template try_get<std::remove_cvref_t<T>>(entity);
+        }
+
+        /// @copydoc try_get(entt::entity) const
+        template <class T>
+        [[nodiscard]] std::remove_cvref_t<T>* try_get(entt::entity const entity) noexcept {
+            return myRegistry->try_get<std::remove_cvref_t<T>>(entity);
+        }
+
+        /**
+         * @brief Returns component's presence.
+         * @details Checks if the object has a component of the specific type.
+         *
+         * @tparam T Type of component.
+         *
+         * @param entity Entity of the object.
+         *
+         * @return Boolean flag indicating the component presence.
+         */
+        template <class T>
+        [[nodiscard]] bool contains(entt::entity const entity) const noexcept {
+            return myRegistry->all_of<std::remove_cvref_t<T>>(entity);
+        }
+
+    private:
+        std::shared_ptr<entt::registry> myOwner;
+        entt::registry* myRegistry;
+    };
+}
+
+#endif
@@ -0,0 +1,301 @@
+#ifndef COLI_GENERIC_BATCH_SYSTEM_H
+#define COLI_GENERIC_BATCH_SYSTEM_H
+
+#include "coli/generic/system.h"
+
+/**
+ * @brief For internal details.
+ * @note The user should not use this namespace.
+ */
+namespace Coli::Generic::Detail
+{
+    template <class List>
+    inline constexpr bool is_copyable_list = false;
+
+    template <class... Types>
+    inline constexpr bool is_copyable_list<TypeList<Types...>> = (std::copyable<std::remove_cv_t<Types>> && ...);
+
+    template <class Components>
+    class BatchProcess;
+
+    template <class... Components>
+    class BatchProcess<TypeList<Components...>> :
+        public SystemBase
+    {
+    protected:
+        BatchProcess() noexcept = default;
+
+    public:
+        BatchProcess(BatchProcess const&) noexcept = default;
+        BatchProcess(BatchProcess&&) noexcept = default;
+
+        BatchProcess& operator=(BatchProcess const&) noexcept = default;
+        BatchProcess& operator=(BatchProcess&&) noexcept = default;
+
+        ~BatchProcess() noexcept override = default;
+
+        virtual void process(std::span<Components>... components) = 0;
+    };
+
+    template <class Components>
+    struct BatchScratch;
+
+    template <class... Components>
+    struct BatchScratch<TypeList<Components...>> {
+        using type = std::tuple<std::vector<std::remove_cv_t<Components>>...>;
+    };
+}
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Base for batch systems.
+     * @details Processes the objects in batches. A batch is a set of
+     * contiguous spans of the required components, one span per component,
+     * and the same index in all the spans refers to the same object.
+     *
+     * To iterate an owning group, list the components the group owns in
+     * `entt::owned_t`, e.g. `entt::owned_t<Position, Velocity const>`. The
+     * group keeps their storages packed in the same order, so their spans
+     * always refer to the storages directly. They are passed to `process`
+     * first, and need not be copyable.
+     *
+     * When the storages of the other components are packed in the same
+     * order, their spans refer to the storages directly too. Otherwise,
+     * they are gathered into a scratch buffer, and the non-const ones are
+     * written back after processing.
+     *
+     * All the objects are processed every execution, so the budget run
+     * policy is not supported.
+     *
+     * @tparam ComponentTys Required and owned components. The required
+     * components that are not owned must be copyable.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     *
+     * @note Interface base. No direct instances are allowed.
+     */
+    template <class... ComponentTys>
+        requires (Detail::valid_signature<ComponentTys...> &&
+                  std::same_as<typename Detail::Signature<ComponentTys...>::optional_type, Detail::TypeList<>> &&
+                  std::same_as<typename Detail::Signature<ComponentTys...>::excluded_type, Detail::TypeList<>> &&
+                  Detail::is_copyable_list<typename Detail::Signature<ComponentTys...>::get_type>)
+    class COLI_EXPORT BatchSystemBase :
+        public Detail::BatchProcess<typename Detail::TypeListCat<
+            typename Detail::Signature<ComponentTys...>::owned_type,
+            typename Detail::Signature<ComponentTys...>::get_type>::type>
+    {
+        using signature_type = Detail::Signature<ComponentTys...>;
+        using owned_type = typename signature_type::owned_type;
+        using gathered_type = typename signature_type::get_type;
+        using component_type = typename Detail::TypeListCat<owned_type, gathered_type>::type;
+        using process_type = Detail::BatchProcess<component_type>;
+
+        template <class... Types>
+        [[nodiscard]] static constexpr std::size_t count_of(Detail::TypeList<Types...>) noexcept {
+            return sizeof...(Types);
+        }
+
+        template <class... Types>
+        [[nodiscard]] static constexpr std::size_t page_size_of(Detail::TypeList<Types...>) noexcept {
+            return std::min({ entt::component_traits<std::remove_cv_t<Types>>::page_size... });
+        }
+
+        /// @brief Count of the owned components, which are always aligned.
+        static constexpr std::size_t owned_count = count_of(owned_type {});
+
+        /// @brief Count of objects in a batch. Batches never cross a storage page.
+        static constexpr std::size_t batch_size = page_size_of(component_type {});
+
+        static_assert(batch_size > 0, "empty components cannot be processed in batches");
+
+        template <class... Components, std::size_t... Is>
+        void process_batches(
+            auto const& objects,
+            std::size_t const size,
+            Detail::TypeList<Components...>,
+            std::index_sequence<Is...>)
+        {
+            auto const* const entities = objects.template storage<0>()->data();
+
+            for (std::size_t begin = 0; begin < size; begin += batch_size)
+            {
+                auto const end = std::min(size, begin + batch_size);
+
+                auto const aligned = ([&] {
+                    if constexpr (Is < owned_count)
+                        return true;
+                    else
+                    {
+                        auto const& other = *objects.template storage<Is>();
+
+                        return other.size() >= end &&
+                               std::equal(entities + begin, entities + end, other.data() + begin);
+                    }
+                } () && ...);
+
+                if (aligned) {
+                    this->count_processed(end - begin);
+                    this->process(std::span<Components>(
+                        std::addressof(objects.template storage<Is>()->get(entities[begin])),
+                        end - begin)...);
+                }
+                else
+                    process_gathered(objects, entities + begin, entities + end,
+                                     Detail::TypeList<Components...>{}, std::index_sequence<Is...>{});
+            }
+        }
+
+        template <class... Components, std::size_t... Is>
+        void process_gathered(
+            auto const& objects,
+            entt::entity const* first,
+            entt::entity const* last,
+            Detail::TypeList<Components...>,
+            std::index_sequence<Is...>)
+        {
+            // Every object of an owning group matches it, so the owned spans stay aligned.
+            auto const* const begin = first;
+
+            myScratchEntities.clear();
+
+            ([&] {
+                if constexpr (Is >= owned_count)
+                    std::get<Is - owned_count>(myScratch).clear();
+            } (), ...);
+
+            for (; first != last; ++first)
+                if (objects.contains(*first))
+                {
+                    myScratchEntities.push_back(*first);
+
+                    ([&] {
+                        if constexpr (Is >= owned_count)
+                            std::get<Is - owned_count>(myScratch).push_back(objects.template storage<Is>()->get(*first));
+                    } (), ...);
+                }
+
+            if (myScratchEntities.empty())
+                return;
+
+            auto const span = [&] <std::size_t I, class T> (std::integral_constant<std::size_t, I>, std::type_identity<T>) {
+                if constexpr (I < owned_count)
+                    return std::span<T>(std::addressof(objects.template storage<I>()->get(*begin)), myScratchEntities.size());
+                else
+                    return std::span<T>(std::get<I - owned_count>(myScratch));
+            };
+
+            this->count_processed(myScratchEntities.size());
+            this->process(span(std::integral_constant<std::size_t, Is> {}, std::type_identity<Components> {})...);
+
+            ([&] {
+                if constexpr (Is >= owned_count && !std::is_const_v<Components>)
+                    for (std::size_t i = 0; i < myScratchEntities.size(); ++i)
+                        objects.template storage<Is>()->get(myScratchEntities[i]) =
+                            std::move(std::get<Is - owned_count>(myScratch)[i]);
+            } (), ...);
+        }
+
+    protected:
+        /**
+         * @detail Creates batch system base.
+         * @details Default constructor. Call it from your
+         * derived classes.
+         */
+        BatchSystemBase() noexcept = default;
+
+    public:
+        /**
+         * @detail Copies batch system base.
+         * @details Copies the system without its scratch buffer.
+         */
+        BatchSystemBase(BatchSystemBase const&) noexcept {}
+
+        /**
+         * @detail Moves batch system base.
+         * @details Has the default implementation.
+         */
+        BatchSystemBase(BatchSystemBase&&) noexcept = default;
+
+        /// @copydoc BatchSystemBase(BatchSystemBase const&)
+        BatchSystemBase& operator=(BatchSystemBase const&) noexcept {
+            return *this;
+        }
+
+        /// @copydoc BatchSystemBase(BatchSystemBase&&)
+        BatchSystemBase& operator=(BatchSystemBase&&) noexcept = default;
+
+        /**
+         * @detail Destroys batch system base.
+         * @details Has the default implementation.
+         */
+        ~BatchSystemBase() noexcept override = default;
+
+        /**
+         * @brief Processes a batch of objects.
+         * @details Processes the user-required components of a run
+         * of objects. All the spans have the same size, the same index
+         * refers to the components of the same object. The spans of
+         * the owned components are passed first.
+         */
+        using process_type::process;
+
+        /**
+         * @brief Updates system.
+         * @details Updates the system. Calls once per frame after
+         * processing all objects.
+         */
+        virtual void update() = 0;
+
+        /**
+         * @brief Returns components access.
+         * @details Declares the required components. Const qualified
+         * components are read, others are written.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Access of the system.
+         */
+        [[nodiscard]] SystemAccess access() const override {
+            return signature_type::access();
+        }
+
+        /**
+         * @brief Prepares the system.
+         * @note The user should not use this method.
+         */
+        void prepare(Game::Scene& scene, Frame const&) override {
+            signature_type::prepare(scene);
+        }
+
+        /**
+         * @brief Executes the system.
+         * @note The user should not use this method.
+         */
+        void execute(Game::Scene& scene, Frame const&) override
+        {
+            auto const objects = signature_type::view(scene);
+
+            // The members of an owning group lead its owned storages.
+            std::size_t size = 0;
+
+            if constexpr (signature_type::is_grouped)
+                size = objects.size();
+            else
+                size = objects.template storage<0>()->size();
+
+            process_batches(objects, size, component_type {},
+                            std::make_index_sequence<count_of(component_type {})>{});
+
+            this->update();
+        }
+
+    private:
+        std::vector<entt::entity> myScratchEntities;
+        typename Detail::BatchScratch<gathered_type>::type myScratch;
+    };
+}
+
+#endif
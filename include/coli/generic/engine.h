@@ -3,6 +3,11 @@
 
 #include "coli/utility.h"
 #include "coli/generic/system.h"
+#include "coli/generic/scheduler.h"
+#include "coli/generic/stats.h"
+#include "coli/generic/task.h"
+#include "coli/generic/worker_pool.h"
+#include "coli/generic/shard.h"
 #include "coli/game/scene.h"
 
 namespace Coli::Generic
@@ -10,25 +15,120 @@ namespace Coli::Generic
     /**
      * @brief Main game engine class.
      * @details Processes systems passing the active scene.
-     * Manages the game state.
+     * Manages the game state. Systems that do not conflict by
+     * their components are executed at the same time. Additional
+     * scenes are simulated by shards in parallel with the active one.
      *
      * @note Not thread-safe. Concurrent access requires
      * external synchronization.
     */
     class COLI_EXPORT Engine final
     {
-        [[noreturn]] static void fail_already_exist();
+        [[noreturn]] static void fail_invalid_loop();
+        [[noreturn]] static void fail_empty_callback();
+        [[noreturn]] static void fail_duplicate_scene();
+        [[noreturn]] static void fail_moved_from();
+
+        [[nodiscard]] static std::size_t default_worker_count() noexcept;
+
+        using clock_type = std::chrono::steady_clock;
+
+        struct Wakeup;
+
+        [[nodiscard]] bool tick(std::chrono::nanoseconds delta, Types::float_type alpha);
+
+        void check_scene(std::weak_ptr<Game::Scene> const& scene, Shard const* except) const;
+
+        void dispatch();
+        void start();
+        void run_continuous();
+        void run_fixed_step();
+        void run_on_demand();
 
     public:
+        /**
+         * @brief Game loop modes.
+         * @details Defines how the game loop advances the time.
+         */
+        enum class LoopMode
+        {
+            /// @brief Executes frames one after another with the measured delta time.
+            Continuous,
+
+            /// @brief Executes frames with the fixed delta time and sleeps between them.
+            FixedStep,
+
+            /**
+             * @brief Executes frames only when requested and blocks otherwise.
+             * @details Waits for a requested redraw or step, a posted callback
+             * or a due timer. A redraw executes a frame that simulates no time,
+             * a step executes a frame that simulates the loop step.
+             */
+            OnDemand
+        };
+
+        /**
+         * @brief Game loop settings.
+         * @details Groups all settings of the game loop.
+         */
+        struct COLI_EXPORT LoopSettings final
+        {
+            /// @brief Mode of the loop.
+            LoopMode mode = LoopMode::Continuous;
+
+            /// @brief Simulated time of a frame in the fixed step mode.
+            std::chrono::nanoseconds step = std::chrono::nanoseconds(16'666'667);
+
+            /**
+             * @brief Maximal count of frames executed to catch up.
+             * @details If the loop falls behind for more frames, the rest
+             * of the time is dropped instead of being simulated.
+             */
+            std::size_t max_catch_up = 5;
+
+            /**
+             * @brief Waits for the GLFW events in the on-demand mode.
+             * @details Blocks in `glfwWaitEventsTimeout` instead of the
+             * engine's own wait, so the window stays responsive. The
+             * loop must run on the main thread with GLFW initialized.
+             * The window callbacks request the frames they need.
+             */
+            bool wait_events = false;
+        };
+
+        /**
+         * @brief Worker threads settings.
+         * @details Groups all settings of the engine's worker pool.
+         */
+        struct COLI_EXPORT WorkerSettings final
+        {
+            /**
+             * @brief Count of the worker threads.
+             * @details If empty, one less than the count of
+             * the hardware threads is used.
+             */
+            std::optional<std::size_t> count;
+
+            /// @brief Pins the workers to the CPUs.
+            bool pin_threads = false;
+        };
+
+        /// @brief Time before a fixed step deadline the loop stops sleeping and starts yielding.
+        static constexpr std::chrono::microseconds sleep_margin { 1000 };
+
         /**
          * @brief Creates game engine.
          * @details Creates a game engine. No active scene, no systems.
+         *
+         * @throw std::bad_alloc If allocation fails.
          */
-        Engine() noexcept(std::is_nothrow_default_constructible_v<decltype(mySystems)>);
+        Engine();
 
         /**
          * @brief Moves game engine.
-         * @details Just moves the game engine.
+         * @details Just moves the game engine. The moved-from engine
+         * ignores the stop, redraw and step requests, and throws on
+         * the posted callbacks.
          *
          * @param other Other game engine.
          */
@@ -73,8 +173,29 @@ namespace Coli::Generic
          *
          * @param scene New active scene weak pointer. Pass expired one to
          * reset the active scene.
+         *
+         * @throw std::invalid_argument If a shard simulates the scene.
          */
-        void active_scene(std::weak_ptr<Game::Scene> scene) noexcept;
+        void active_scene(std::weak_ptr<Game::Scene> scene);
+
+        /**
+         * @brief Returns loop settings.
+         * @details Returns the settings of the game loop.
+         *
+         * @return Loop settings.
+         */
+        [[nodiscard]] LoopSettings const& loop_settings() const noexcept;
+
+        /**
+         * @brief Sets loop settings.
+         * @details Sets the settings used by the next @ref run().
+         *
+         * @param settings New loop settings.
+         *
+         * @throw std::invalid_argument If the step is not positive or
+         * the catch-up count is zero.
+         */
+        void loop_settings(LoopSettings const& settings);
 
         /**
          * @brief Makes system.
@@ -93,30 +214,33 @@ namespace Coli::Generic
          */
         template <std::derived_from<Detail::SystemBase> T, class... Args>
             requires (std::constructible_from<std::remove_cvref_t<T>, Args...>)
-        std::weak_ptr<std::remove_cvref_t<T>> make_system(Args&&... args)
-        {
-            using type = std::remove_cvref_t<T>;
-
-            constexpr auto const& type_info = typeid(type);
-
-            auto [iter, inserted] = mySystems.try_emplace(type_info, nullptr);
-
-            if (inserted) {
-                std::shared_ptr<type> newSystem;
-
-                try {
-                    newSystem = std::make_shared<type>(std::forward<Args>(args)...);
-                }
-                catch (...) {
-                    mySystems.erase(iter);
-                    throw;
-                }
-
-                iter->second = newSystem;
-                return newSystem;
-            }
+        std::weak_ptr<std::remove_cvref_t<T>> make_system(Args&&... args) {
+            return myMain.make_system<T>(std::forward<Args>(args)...);
+        }
 
-            fail_already_exist();
+        /**
+         * @brief Makes system with run policy.
+         * @detail Makes a system of the specific type that is executed
+         * according to the policy, e.g. at a fixed rate or within a time
+         * budget, and returns a weak smart pointer to it.
+         *
+         * @tparam T Type of system to add. It must be derived from Coli::Generic::SystemBase;
+         * @tparam Args Types of T constructor arguments.
+         *
+         * @param policy Run policy of the system;
+         * @param args Arguments to a T type constructor.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw std::invalid_argument If the system does not support the policy;
+         * @throw std::logic_error If the system are already exists;
+         * @throw T Any of T(Args...) constructor exceptions.
+         *
+         * @return A weak pointer to the newly created system.
+         */
+        template <std::derived_from<Detail::SystemBase> T, class... Args>
+            requires (std::constructible_from<std::remove_cvref_t<T>, Args...>)
+        std::weak_ptr<std::remove_cvref_t<T>> make_system(RunPolicy const& policy, Args&&... args) {
+            return myMain.make_system<T>(policy, std::forward<Args>(args)...);
         }
 
         /**
@@ -131,26 +255,40 @@ namespace Coli::Generic
          * @retval Valid If there is a system of this type;
          * @retval Expired If no systems of the T type.
          */
-        template <class T>
-        [[nodiscard]] std::weak_ptr<std::remove_cvref_t<T> const> get_system() const noexcept
-        {
-            using type = std::remove_cvref_t<T>;
-
-            constexpr auto const& type_info = typeid(type);
-            auto iter = mySystems.find(type_info);
-
-            if (iter != mySystems.end())
-                if (auto const system = std::dynamic_pointer_cast<type>(iter->second))
-                    return system;
-
-            return nullptr;
+        template <std::derived_from<Detail::SystemBase> T>
+        [[nodiscard]] std::weak_ptr<std::remove_cvref_t<T> const> get_system() const noexcept {
+            return myMain.get_system<T>();
         }
 
         /// @copydoc get_system() const
-        template <class T>
+        template <std::derived_from<Detail::SystemBase> T>
         [[nodiscard]] std::weak_ptr<std::remove_cvref_t<T>> get_system() noexcept {
-            return std::const_pointer_cast
-                <std::remove_cvref_t<T>>(std::as_const(*this).get_system<T>().lock());
+            return myMain.get_system<T>();
+        }
+
+        /**
+         * @brief Finds system.
+         * @detail Returns the system of the specific type if
+         * the game engine contains some. Unlike @ref get_system(),
+         * does not touch the reference counters, so it is cheap enough
+         * for hot paths. The pointer is valid until the system is removed.
+         *
+         * @tparam T Type of system to find. It must be derived from Coli::Generic::SystemBase.
+         *
+         * @return A pointer to the system.
+         *
+         * @retval Valid If there is a system of this type;
+         * @retval Null If no systems of the T type.
+         */
+        template <std::derived_from<Detail::SystemBase> T>
+        [[nodiscard]] std::remove_cvref_t<T> const* find_system() const noexcept {
+            return myMain.find_system<T>();
+        }
+
+        /// @copydoc find_system() const
+        template <std::derived_from<Detail::SystemBase> T>
+        [[nodiscard]] std::remove_cvref_t<T>* find_system() noexcept {
+            return myMain.find_system<T>();
         }
 
         /**
@@ -160,39 +298,280 @@ namespace Coli::Generic
          *
          * @tparam T Type of system to destroy. It must be derived from Coli::Generic::SystemBase.
          */
-        template <class T>
-        void remove_system() noexcept
-        {
-            using type = std::remove_cvref_t<T>;
+        template <std::derived_from<Detail::SystemBase> T>
+        void remove_system() noexcept {
+            myMain.remove_system<T>();
+        }
+
+        /**
+         * @brief Adds shard.
+         * @details Adds a shard that simulates the scene with its own
+         * systems and tick rate. The shards are stepped in parallel with
+         * each other and with the active scene on the worker pool. Each
+         * shard is stepped as many times as its steps fit the time
+         * simulated by the engine, but no more than `max_catch_up` times
+         * per frame. Must not be called while the game is running.
+         *
+         * A scene is simulated by one shard only, since the shards are
+         * stepped in parallel. Keep it so when changing the scene of
+         * a shard via @ref Shard::scene().
+         *
+         * @param scene Scene of the shard;
+         * @param step Simulated time of a frame of the shard.
+         *
+         * @throw std::invalid_argument If the step is not positive,
+         * or the active scene or another shard simulates the scene;
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Reference to the shard. It is valid until the shard is removed.
+         */
+        Shard& add_shard(std::weak_ptr<Game::Scene> scene, std::chrono::nanoseconds step = Shard::default_step);
+
+        /**
+         * @brief Removes shard.
+         * @details Destroys the shard and its systems. Must not be called
+         * while the game is running.
+         *
+         * @param shard Shard to remove.
+         */
+        void remove_shard(Shard const& shard) noexcept;
+
+        /**
+         * @brief Returns shards count.
+         * @details Returns the count of the added shards.
+         *
+         * @return Count of the shards.
+         */
+        [[nodiscard]] std::size_t shard_count() const noexcept;
+
+        /**
+         * @brief Returns shard.
+         * @details Returns the shard by its index in the adding order.
+         *
+         * @param index Index of the shard.
+         *
+         * @return Reference to the shard.
+         */
+        [[nodiscard]] Shard& shard(std::size_t index) noexcept;
+
+        /// @copydoc shard(std::size_t)
+        [[nodiscard]] Shard const& shard(std::size_t index) const noexcept;
+
+        /**
+         * @brief Returns worker settings.
+         * @details Returns the settings of the worker pool.
+         *
+         * @return Worker settings.
+         */
+        [[nodiscard]] WorkerSettings const& worker_settings() const noexcept;
+
+        /**
+         * @brief Sets worker settings.
+         * @details Stops the current worker pool, if any. The next pool
+         * is created with the new settings when it is needed. Must not be
+         * called while the game is running.
+         *
+         * @param settings New worker settings.
+         */
+        void worker_settings(WorkerSettings const& settings) noexcept;
+
+        /**
+         * @brief Returns worker pool.
+         * @details Returns the job system of the engine, creating it if
+         * necessary. Systems get the same pool from their frame context.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw std::system_error If the worker threads cannot be started.
+         *
+         * @return Worker pool.
+         */
+        [[nodiscard]] WorkerPool& workers();
+
+        /**
+         * @brief Returns frame arena.
+         * @details Returns the arena for the allocations that live no
+         * longer than a frame. It has an arena per worker pool slot and
+         * is reset at the end of every frame. Check its high-water mark
+         * to choose the block size.
+         *
+         * @return Frame arena.
+         */
+        [[nodiscard]] FrameArena& arena() noexcept;
+
+        /// @copydoc arena()
+        [[nodiscard]] FrameArena const& arena() const noexcept;
+
+        /**
+         * @brief Returns frame commands.
+         * @details Returns the command buffers the systems record the
+         * structural changes to. It has a buffer per worker pool slot
+         * and is flushed after the systems of every frame.
+         *
+         * @return Frame commands.
+         */
+        [[nodiscard]] FrameCommands& commands() noexcept;
+
+        /**
+         * @brief Returns event bus.
+         * @details Returns the bus the systems of the main scene
+         * communicate through. The events published in a frame are
+         * readable in the next one.
+         *
+         * @return Event bus.
+         */
+        [[nodiscard]] EventBus& events() noexcept;
+
+        /**
+         * @brief Returns frame timers.
+         * @details Returns the timers of the systems of the main scene.
+         * They are measured in frames and advanced at the beginning
+         * of every frame.
+         *
+         * @return Frame timers.
+         */
+        [[nodiscard]] FrameTimers& timers() noexcept;
+
+        /**
+         * @brief Starts task.
+         * @details Starts the coroutine task. The tasks are resumed at
+         * the beginning of every frame, before the systems are executed.
+         * Delays are measured in the simulated time of the frames.
+         *
+         * @param task Task to start.
+         *
+         * @throw std::invalid_argument If the task is empty or has already started;
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void start_task(Task task);
+
+        /**
+         * @brief Returns tasks.
+         * @details Returns the scheduler of the started tasks.
+         *
+         * @return Tasks scheduler.
+         */
+        [[nodiscard]] TaskScheduler const& tasks() const noexcept;
+
+        /**
+         * @brief Returns frame statistics.
+         * @details Returns the statistics of the last frames executed
+         * by @ref run() or @ref run_frames().
+         *
+         * @return Frame statistics.
+         */
+        [[nodiscard]] FrameStats const& stats() const noexcept;
 
-            constexpr auto const& type_info = typeid(type);
-            auto iter = mySystems.find(type_info);
+        /**
+         * @brief Sets statistics capacity.
+         * @details Drops the recorded statistics and keeps
+         * the specified count of the last frames from now on.
+         *
+         * @param capacity Count of the last frames to keep.
+         *
+         * @throw std::invalid_argument If the capacity is zero;
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void stats_capacity(std::size_t capacity);
 
-            if (iter != mySystems.end())
-                mySystems.erase(iter);
+        /**
+         * @brief Returns system statistics.
+         * @details Summarizes the time of the system of
+         * the specific type in the last frames.
+         *
+         * @tparam T Type of the system.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Summary of the system. Has no samples if there is
+         * no system of this type or it has not been executed yet.
+         */
+        template <std::derived_from<Detail::SystemBase> T>
+        [[nodiscard]] StatsSummary system_stats() const {
+            return myMain.system_stats<T>();
         }
 
+        /**
+         * @brief Runs frames.
+         * @details Executes the specified count of frames back to back,
+         * without sleeping. Every frame simulates the loop step, so the
+         * result does not depend on the wall time. Stops earlier if
+         * @ref stop() is called or the active scene expires. Drops the
+         * previously recorded statistics. Useful for headless benchmarks.
+         *
+         * @param count Count of frames to execute.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw std::system_error If the worker threads cannot be started;
+         * @throw Any The first exception thrown by a system.
+         *
+         * @return Statistics of the executed frames.
+         */
+        FrameStats const& run_frames(std::size_t count);
+
         /**
          * @brief Runs game.
          * @detail Runs the game loop.
          * It is running while the running flag is True.
-         * To stop it, call @ref stop().
+         * To stop it, call @ref stop(). In the fixed step mode,
+         * the loop sleeps until the next step is due.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw std::system_error If the worker threads cannot be started;
+         * @throw Any The first exception thrown by a system.
          */
         void run();
 
         /**
          * @brief Stops game.
-         * @detail Stops the game loop.
+         * @detail Stops the game loop after the current frame.
+         * Safe to call from any thread.
          */
         void stop() noexcept;
 
+        /**
+         * @brief Requests redraw.
+         * @detail Makes the on-demand loop execute a frame that simulates
+         * no time, e.g. after the editor changed the scene. Requests made
+         * before the frame starts are merged. Safe to call from any thread.
+         */
+        void request_redraw() noexcept;
+
+        /**
+         * @brief Requests steps.
+         * @detail Makes the on-demand loop execute frames that simulate
+         * the loop step each. Safe to call from any thread.
+         *
+         * @param count Count of frames to execute.
+         */
+        void step(std::size_t count = 1) noexcept;
+
+        /**
+         * @brief Posts callback.
+         * @detail Executes the callback on the loop thread at the beginning
+         * of the next frame after the delay. In the on-demand mode, the
+         * loop wakes up and executes a frame for it. Safe to call from
+         * any thread.
+         *
+         * @param callback Callback to execute;
+         * @param delay Wall time to wait before the execution.
+         *
+         * @throw std::invalid_argument If the callback is empty;
+         * @throw std::logic_error If the engine was moved from;
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void post(std::function<void()> callback, std::chrono::nanoseconds delay = std::chrono::nanoseconds::zero());
+
     private:
-        std::unordered_map<std::type_index,
-                           std::shared_ptr<Detail::SystemBase>>
-        mySystems;
+        Shard myMain;
+        std::vector<std::unique_ptr<Shard>> myShards;
+
+        std::unique_ptr<TaskScheduler> myTasks;
+        std::unique_ptr<WorkerPool> myWorkers;
+        WorkerSettings myWorkerSettings;
 
-        std::weak_ptr<Game::Scene> myScene;
-        volatile /* <- temp */ bool myStopFlag;
+        LoopSettings myLoop;
+        std::atomic<bool> myStopFlag;
+        std::unique_ptr<Wakeup> myWakeup;
     };
 }
 
@@ -0,0 +1,376 @@
+#ifndef COLI_GENERIC_EVENT_BUS_H
+#define COLI_GENERIC_EVENT_BUS_H
+
+#include "coli/utility.h"
+#include "coli/generic/worker_pool.h"
+
+/**
+ * @brief For internal details.
+ * @note The user should not use this namespace.
+ */
+namespace Coli::Generic::Detail
+{
+    class COLI_EXPORT EventIndex final
+    {
+        [[nodiscard]] static std::size_t next() noexcept;
+
+    public:
+        EventIndex() = delete;
+
+        template <class T>
+        [[nodiscard]] static std::size_t value() noexcept
+        {
+            static std::size_t const index = next();
+            return index;
+        }
+    };
+
+    class COLI_EXPORT EventChannelBase
+    {
+    protected:
+        explicit EventChannelBase(entt::id_type type) noexcept;
+
+    public:
+        EventChannelBase(EventChannelBase&&) = delete;
+        EventChannelBase(EventChannelBase const&) = delete;
+
+        EventChannelBase& operator=(EventChannelBase&&) = delete;
+        EventChannelBase& operator=(EventChannelBase const&) = delete;
+
+        virtual ~EventChannelBase() noexcept;
+
+        virtual void swap() = 0;
+        virtual void clear() noexcept = 0;
+
+        [[nodiscard]] entt::id_type type() const noexcept;
+        [[nodiscard]] std::size_t frame() const noexcept;
+        [[nodiscard]] std::uint64_t total() const noexcept;
+
+    protected:
+        void count(std::size_t events) noexcept;
+
+    private:
+        entt::id_type myType;
+        std::size_t myFrame;
+        std::uint64_t myTotal;
+    };
+
+    template <std::movable T>
+    class EventChannel final :
+        public EventChannelBase
+    {
+        struct alignas(Utility::cache_line_size) Slot {
+            std::vector<T> events;
+        };
+
+    public:
+        explicit EventChannel(std::size_t const slots) :
+            EventChannelBase (entt::type_hash<T>::value()),
+            mySlots          (std::make_unique<Slot[]>(slots)),
+            mySize           (slots)
+        {}
+
+        template <class... Args>
+        void publish(std::size_t const slot, Args&&... args) {
+            mySlots[slot].events.emplace_back(std::forward<Args>(args)...);
+        }
+
+        template <class... Args>
+        void publish_external(Args&&... args)
+        {
+            std::lock_guard const lock { myMutex };
+            myExternal.emplace_back(std::forward<Args>(args)...);
+        }
+
+        [[nodiscard]] std::span<T const> read() const noexcept {
+            return myRead;
+        }
+
+        void swap() override
+        {
+            std::lock_guard const lock { myMutex };
+
+            std::vector<T>* single = nullptr;
+            std::size_t sources = 0;
+            std::size_t size = 0;
+
+            auto const visit = [&] (std::vector<T>& events) {
+                if (!events.empty()) {
+                    single = std::addressof(events);
+                    size += events.size();
+                    ++sources;
+                }
+            };
+
+            for (std::size_t i = 0; i < mySize; ++i)
+                visit(mySlots[i].events);
+
+            visit(myExternal);
+            myRead.clear();
+
+            // A single written buffer becomes the read one, and the read one
+            // is reused for writing, so the events are not moved.
+            if (sources == 1)
+                myRead.swap(*single);
+            else if (sources > 1)
+            {
+                myRead.reserve(size);
+
+                auto const gather = [this] (std::vector<T>& events) {
+                    myRead.insert(myRead.end(), std::make_move_iterator(events.begin()), std::make_move_iterator(events.end()));
+                    events.clear();
+                };
+
+                for (std::size_t i = 0; i < mySize; ++i)
+                    gather(mySlots[i].events);
+
+                gather(myExternal);
+            }
+
+            count(myRead.size());
+        }
+
+        void clear() noexcept override
+        {
+            for (std::size_t i = 0; i < mySize; ++i)
+                mySlots[i].events.clear();
+
+            std::lock_guard const lock { myMutex };
+
+            myExternal.clear();
+            myRead.clear();
+        }
+
+    private:
+        std::unique_ptr<Slot[]> mySlots;
+        std::size_t mySize;
+        std::vector<T> myExternal;
+        std::mutex myMutex;
+        std::vector<T> myRead;
+    };
+}
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Event volume.
+     * @details Counters of the events of a type.
+     */
+    struct EventCounter
+    {
+        /// @brief Hash of the event type.
+        entt::id_type type = 0;
+
+        /// @brief Count of the events published in the last frame.
+        std::size_t frame = 0;
+
+        /// @brief Count of the events published since the bus creation.
+        std::uint64_t total = 0;
+    };
+
+    /**
+     * @brief Event bus.
+     * @details Typed events for the communication between the systems.
+     * The events published in a frame are readable in the next one: the
+     * engine swaps the bus after the systems of every frame. Each worker
+     * pool slot has its own buffer per event type, so the systems may
+     * publish from any worker without locks, and the swap gathers the
+     * buffers into a contiguous span per type. The buffers keep their
+     * memory between frames, so publishing does not allocate once the
+     * volume settles.
+     *
+     * The 0 slot buffer belongs to the thread that swapped the bus last,
+     * or created it before the first swap. The other threads out of the
+     * worker pool publish into a shared buffer under a lock, which is
+     * gathered after the slots.
+     *
+     * @note Publishing and reading are thread-safe while the bus is not
+     * swapped. Other access requires external synchronization.
+     */
+    class COLI_EXPORT EventBus final
+    {
+        [[noreturn]] static void fail_too_many_types();
+
+        template <class T>
+        [[nodiscard]] Detail::EventChannel<T>* find_channel() const noexcept
+        {
+            auto const index = Detail::EventIndex::value<T>();
+
+            if (index < max_types)
+                return static_cast<Detail::EventChannel<T>*>(myChannels[index].load(std::memory_order_acquire));
+
+            return nullptr;
+        }
+
+        template <class T>
+        [[nodiscard]] Detail::EventChannel<T>& channel()
+        {
+            if (auto* const channel = find_channel<T>()) [[likely]]
+                return *channel;
+
+            auto const index = Detail::EventIndex::value<T>();
+
+            if (index >= max_types)
+                fail_too_many_types();
+
+            std::lock_guard const lock { *myMutex };
+
+            if (auto* const channel = find_channel<T>())
+                return *channel;
+
+            auto newChannel = std::make_unique<Detail::EventChannel<T>>(mySize);
+            auto* const channel = newChannel.get();
+
+            myOwned.push_back(std::move(newChannel));
+            myChannels[index].store(channel, std::memory_order_release);
+
+            return *channel;
+        }
+
+    public:
+        /// @brief Maximum count of the event types.
+        static constexpr std::size_t max_types = 256;
+
+        /**
+         * @brief Creates event bus.
+         * @details Creates a bus without events for the specific count of slots.
+         *
+         * @param slots Count of the worker pool slots.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        explicit EventBus(std::size_t slots = 1);
+
+        /**
+         * @brief Moves event bus.
+         * @details Just moves the channels.
+         *
+         * @param other Other event bus.
+         */
+        EventBus(EventBus&& other) noexcept;
+        EventBus(EventBus const&) = delete;
+
+        /// @copydoc EventBus(EventBus&&)
+        EventBus& operator=(EventBus&& other) noexcept;
+        EventBus& operator=(EventBus const&) = delete;
+
+        /// @brief Destroys event bus.
+        ~EventBus() noexcept;
+
+        /**
+         * @brief Publishes event.
+         * @details Constructs the event in the buffer of the calling
+         * thread slot, or in the shared one if the thread is neither
+         * a worker nor the owner of the 0 slot. The event is readable
+         * after the next swap.
+         *
+         * @tparam T Type of the event;
+         * @tparam Args Types of T constructor arguments.
+         *
+         * @param args Arguments to a T type constructor.
+         *
+         * @throw std::length_error If there are too many event types;
+         * @throw std::out_of_range If the calling thread slot is out of
+         * the slots range;
+         * @throw std::bad_alloc If allocation fails;
+         * @throw T Any of T(Args...) constructor exceptions.
+         */
+        template <std::movable T, class... Args>
+            requires (std::constructible_from<T, Args...>)
+        void publish(Args&&... args)
+        {
+            auto& target = channel<T>();
+            auto const slot = WorkerPool::current_slot(mySize);
+
+            if (slot != 0 || std::this_thread::get_id() == myOwner) [[likely]]
+                target.publish(slot, std::forward<Args>(args)...);
+            else
+                target.publish_external(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Reads events.
+         * @details Returns the events of the specific type
+         * published in the previous frame.
+         *
+         * @tparam T Type of the event.
+         *
+         * @return Contiguous span of the events. Valid until the next swap.
+         */
+        template <std::movable T>
+        [[nodiscard]] std::span<T const> read() const noexcept
+        {
+            if (auto const* const channel = find_channel<T>())
+                return channel->read();
+
+            return {};
+        }
+
+        /**
+         * @brief Returns event counter.
+         * @details Returns the volume of the events of the specific type.
+         *
+         * @tparam T Type of the event.
+         *
+         * @return Counter of the events. It is zero if
+         * nothing of this type has been published.
+         */
+        template <std::movable T>
+        [[nodiscard]] EventCounter counter() const noexcept
+        {
+            if (auto const* const channel = find_channel<T>())
+                return { channel->type(), channel->frame(), channel->total() };
+
+            return { entt::type_hash<T>::value() };
+        }
+
+        /**
+         * @brief Returns event counters.
+         * @details Returns the volume of the events of every type
+         * that has been published.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Counters of the event types.
+         */
+        [[nodiscard]] std::vector<EventCounter> counters() const;
+
+        /**
+         * @brief Returns slots count.
+         * @details Returns the count of the buffers per event type.
+         *
+         * @return Count of the slots.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * @brief Swaps buffers.
+         * @details Makes the events published since the last swap
+         * readable and drops the previously readable ones. The calling
+         * thread becomes the owner of the 0 slot buffers. When the events
+         * of a type were published into one buffer only, it becomes
+         * readable without moving them, otherwise they are gathered.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw Any Exceptions of the event move constructors.
+         */
+        void swap();
+
+        /**
+         * @brief Clears events.
+         * @details Drops both the published and the readable
+         * events. The counters are kept.
+         */
+        void clear() noexcept;
+
+    private:
+        std::unique_ptr<std::atomic<Detail::EventChannelBase*>[]> myChannels;
+        std::vector<std::unique_ptr<Detail::EventChannelBase>> myOwned;
+        std::unique_ptr<std::mutex> myMutex;
+        std::size_t mySize;
+        std::thread::id myOwner;
+    };
+}
+
+#endif
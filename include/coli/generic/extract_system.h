@@ -0,0 +1,139 @@
+#ifndef COLI_GENERIC_EXTRACT_SYSTEM_H
+#define COLI_GENERIC_EXTRACT_SYSTEM_H
+
+#include "coli/generic/system.h"
+#include "coli/generic/render_exchange.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Base for extraction systems.
+     * @details Copies the render-relevant components of the objects into
+     * a render snapshot and publishes it to a render exchange, so a render
+     * thread submits the frame while the next one is simulated. The
+     * components are only read, so add the system after the systems that
+     * write them to extract their final state.
+     *
+     * @tparam Item Type of the extracted items;
+     * @tparam ComponentTys Required components.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     *
+     * @note Interface base. No direct instances are allowed.
+     */
+    template <class Item, class... ComponentTys>
+        requires (sizeof...(ComponentTys) > 0)
+    class COLI_EXPORT ExtractSystemBase :
+        public Detail::SystemBase
+    {
+        using signature_type = Detail::Signature<std::remove_cv_t<ComponentTys> const...>;
+
+    protected:
+        /**
+         * @detail Creates extraction system base.
+         * @details Call it from your derived classes.
+         *
+         * @param exchange Exchange to publish the snapshots to.
+         * It must outlive the system.
+         */
+        explicit ExtractSystemBase(RenderExchange<Item>& exchange) noexcept :
+            myExchange (std::addressof(exchange))
+        {}
+
+    public:
+        /**
+         * @detail Copies extraction system base.
+         * @details Has the default implementation.
+         */
+        ExtractSystemBase(ExtractSystemBase const&) noexcept = default;
+
+        /**
+         * @detail Moves extraction system base.
+         * @details Has the default implementation.
+         */
+        ExtractSystemBase(ExtractSystemBase&&) noexcept = default;
+
+        /// @copydoc ExtractSystemBase(ExtractSystemBase const&)
+        ExtractSystemBase& operator=(ExtractSystemBase const&) noexcept = default;
+
+        /// @copydoc ExtractSystemBase(ExtractSystemBase&&)
+        ExtractSystemBase& operator=(ExtractSystemBase&&) noexcept = default;
+
+        /**
+         * @detail Destroys extraction system base.
+         * @details Has the default implementation.
+         */
+        ~ExtractSystemBase() noexcept override = default;
+
+        /**
+         * @brief Extracts one object.
+         * @details Appends the render items of an object to the snapshot.
+         * It calls for each object that has all of required components.
+         *
+         * @param items Items of the snapshot;
+         * @param components Required components to extract.
+         */
+        virtual void extract(std::vector<Item>& items, std::remove_cv_t<ComponentTys> const&... components) = 0;
+
+        /**
+         * @brief Returns render exchange.
+         * @details Returns the exchange the snapshots are published to.
+         *
+         * @return Reference to the exchange.
+         */
+        [[nodiscard]] RenderExchange<Item>& exchange() const noexcept {
+            return *myExchange;
+        }
+
+        /**
+         * @brief Returns components access.
+         * @details Declares the required components as read.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Access of the system.
+         */
+        [[nodiscard]] SystemAccess access() const override {
+            return signature_type::access();
+        }
+
+        /**
+         * @brief Prepares the system.
+         * @note The user should not use this method.
+         */
+        void prepare(Game::Scene& scene, Frame const&) override {
+            signature_type::prepare(scene);
+        }
+
+        /**
+         * @brief Executes the system.
+         * @note The user should not use this method.
+         */
+        void execute(Game::Scene& scene, Frame const& frame) override
+        {
+            auto objects = signature_type::view(scene);
+            auto& snapshot = myExchange->write();
+
+            snapshot.items.clear();
+            snapshot.frame = frame.index();
+            snapshot.alpha = frame.alpha();
+
+            std::size_t count = 0;
+
+            objects.each([&] (std::remove_cv_t<ComponentTys> const&... components) {
+                this->extract(snapshot.items, components...);
+                ++count;
+            });
+
+            myExchange->publish();
+            this->count_processed(count);
+        }
+
+    private:
+        RenderExchange<Item>* myExchange;
+    };
+}
+
+#endif
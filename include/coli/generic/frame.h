@@ -0,0 +1,166 @@
+#ifndef COLI_GENERIC_FRAME_H
+#define COLI_GENERIC_FRAME_H
+
+#include "coli/utility.h"
+#include "coli/generic/worker_pool.h"
+#include "coli/generic/frame_arena.h"
+#include "coli/generic/frame_commands.h"
+#include "coli/generic/event_bus.h"
+#include "coli/generic/timer_wheel.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Frame context.
+     * @details Groups the engine services available to the systems
+     * while they are executed in a frame.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT Frame final
+    {
+    public:
+        /**
+         * @brief Creates frame context.
+         * @details Creates a frame context that refers to
+         * the engine services.
+         *
+         * @param workers Worker pool of the engine;
+         * @param arena Frame arena of the engine;
+         * @param commands Frame commands of the engine;
+         * @param events Event bus of the engine;
+         * @param timers Frame timers of the engine;
+         * @param delta Simulated time of the frame in seconds;
+         * @param alpha Interpolation factor of the frame;
+         * @param index Index of the frame.
+         */
+        explicit Frame(
+            WorkerPool& workers,
+            FrameArena& arena,
+            FrameCommands& commands,
+            EventBus& events,
+            FrameTimers& timers,
+            Types::float_type delta = 0,
+            Types::float_type alpha = 1,
+            std::uint64_t index = 0) noexcept;
+
+        /**
+         * @brief Copies frame context.
+         * @details Has the default implementation.
+         */
+        Frame(Frame const&) noexcept;
+
+        /// @copydoc Frame(Frame const&)
+        Frame& operator=(Frame const&) noexcept;
+
+        /// @brief Destroys frame context.
+        ~Frame() noexcept;
+
+        /**
+         * @brief Returns worker pool.
+         * @details Returns the worker pool the systems
+         * are executed on.
+         *
+         * @return Reference to the worker pool.
+         */
+        [[nodiscard]] WorkerPool& workers() const noexcept;
+
+        /**
+         * @brief Returns frame arena.
+         * @details Returns the arenas the memory of which is freed
+         * at the end of the frame.
+         *
+         * @return Reference to the frame arena.
+         */
+        [[nodiscard]] FrameArena& arena() const noexcept;
+
+        /**
+         * @brief Returns frame memory.
+         * @details Returns the frame arena of the calling thread. Use it
+         * for the temporary containers, e.g. `std::pmr::vector`. The memory
+         * must not be used after the frame.
+         *
+         * @throw std::out_of_range If the calling thread slot is out of
+         * the slots range.
+         *
+         * @return Memory resource of the calling thread.
+         */
+        [[nodiscard]] std::pmr::memory_resource* memory() const;
+
+        /**
+         * @brief Returns command buffer.
+         * @details Returns the command buffer of the calling thread. The
+         * recorded changes are applied after all the systems of the frame.
+         * Use it to create and destroy objects or to add and remove
+         * components while iterating.
+         *
+         * @throw std::out_of_range If the calling thread slot is out of
+         * the slots range.
+         *
+         * @return Reference to the command buffer.
+         */
+        [[nodiscard]] Game::CommandBuffer& commands() const;
+
+        /**
+         * @brief Returns event bus.
+         * @details Returns the bus to publish the events to and to read
+         * the events of the previous frame from.
+         *
+         * @return Reference to the event bus.
+         */
+        [[nodiscard]] EventBus& events() const noexcept;
+
+        /**
+         * @brief Returns frame timers.
+         * @details Returns the timers of the engine measured in frames.
+         * Read the objects whose timers fired in this frame and schedule
+         * the timers of the next ones through it.
+         *
+         * @return Reference to the frame timers.
+         */
+        [[nodiscard]] FrameTimers& timers() const noexcept;
+
+        /**
+         * @brief Returns delta time.
+         * @details Returns the time simulated by the frame. In the fixed
+         * step loop it is always the step.
+         *
+         * @return Delta time in seconds.
+         */
+        [[nodiscard]] Types::float_type delta() const noexcept;
+
+        /**
+         * @brief Returns interpolation factor.
+         * @details Returns the part of the fixed step that has passed
+         * but is not simulated yet. Use it to interpolate between the
+         * previous and the current state on presentation. It is always
+         * 1 in the continuous loop.
+         *
+         * @return Interpolation factor in [0, 1].
+         */
+        [[nodiscard]] Types::float_type alpha() const noexcept;
+
+        /**
+         * @brief Returns frame index.
+         * @details Returns the count of frames executed by
+         * the engine before this one.
+         *
+         * @return Index of the frame.
+         */
+        [[nodiscard]] std::uint64_t index() const noexcept;
+
+    private:
+        WorkerPool* myWorkers;
+        FrameArena* myArena;
+        FrameCommands* myCommands;
+        EventBus* myEvents;
+        FrameTimers* myTimers;
+        Types::float_type myDelta;
+        Types::float_type myAlpha;
+        std::uint64_t myIndex;
+    };
+}
+
+#endif
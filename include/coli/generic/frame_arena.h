@@ -0,0 +1,207 @@
+#ifndef COLI_GENERIC_FRAME_ARENA_H
+#define COLI_GENERIC_FRAME_ARENA_H
+
+#include "coli/utility.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Linear arena.
+     * @details Memory resource that allocates by bumping a pointer and
+     * frees everything at once on reset. Deallocation does nothing. When
+     * the block is exhausted, a larger one is added. On reset, the blocks
+     * are merged into one, so the next usage of the same size fits
+     * a single block and the reset takes constant time.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT LinearArena final :
+        public std::pmr::memory_resource
+    {
+        void add_block(std::size_t size);
+
+    public:
+        /// @brief Default size of the first block in bytes.
+        static constexpr std::size_t default_block_size = 64 * 1024;
+
+        /**
+         * @brief Creates linear arena.
+         * @details Creates an arena. The first block is allocated
+         * on the first allocation.
+         *
+         * @param block_size Size of the first block in bytes.
+         */
+        explicit LinearArena(std::size_t block_size = default_block_size) noexcept;
+
+        /**
+         * @brief Moves linear arena.
+         * @details Just moves the blocks. The memory allocated from
+         * the other arena stays valid until this one is reset.
+         *
+         * @param other Other arena.
+         */
+        LinearArena(LinearArena&& other) noexcept;
+        LinearArena(LinearArena const&) = delete;
+
+        /// @copydoc LinearArena(LinearArena&&)
+        LinearArena& operator=(LinearArena&& other) noexcept;
+        LinearArena& operator=(LinearArena const&) = delete;
+
+        /**
+         * @brief Destroys linear arena.
+         * @details Frees all the blocks.
+         */
+        ~LinearArena() noexcept override;
+
+        /**
+         * @brief Resets arena.
+         * @details Frees all the allocated memory at once and
+         * updates the high-water mark.
+         *
+         * @throw std::bad_alloc If allocation of the merged block fails.
+         */
+        void reset();
+
+        /**
+         * @brief Returns used size.
+         * @details Returns the count of the bytes allocated since
+         * the last reset, including the alignment padding.
+         *
+         * @return Used size in bytes.
+         */
+        [[nodiscard]] std::size_t used() const noexcept;
+
+        /**
+         * @brief Returns capacity.
+         * @details Returns the total size of the blocks.
+         *
+         * @return Capacity in bytes.
+         */
+        [[nodiscard]] std::size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns high-water mark.
+         * @details Returns the maximal used size between resets.
+         *
+         * @return High-water mark in bytes.
+         */
+        [[nodiscard]] std::size_t high_water() const noexcept;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+
+        [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override;
+
+        std::vector<std::unique_ptr<std::byte[]>> myBlocks;
+
+        std::byte* myCurrent;
+        std::size_t myOffset;
+        std::size_t myBlockSize;
+
+        std::size_t myCapacity;
+        std::size_t myUsed;
+        std::size_t myHighWater;
+    };
+
+    /**
+     * @brief Frame arena.
+     * @details Linear arenas for the allocations that live no longer
+     * than a frame, one per worker pool slot. The engine resets it at
+     * the end of every frame. Use @ref local() as the memory resource
+     * of the temporary containers, e.g. `std::pmr::vector`.
+     *
+     * @note Each thread must only use its own arena. Other access
+     * requires external synchronization.
+     */
+    class COLI_EXPORT FrameArena final
+    {
+        struct alignas(Utility::cache_line_size) Slot {
+            LinearArena arena;
+        };
+
+    public:
+        /**
+         * @brief Creates frame arena.
+         * @details Creates the arenas for the specific count of slots.
+         *
+         * @param slots Count of the worker pool slots;
+         * @param block_size Size of the first block of each arena in bytes.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        explicit FrameArena(std::size_t slots = 1, std::size_t block_size = LinearArena::default_block_size);
+
+        /**
+         * @brief Moves frame arena.
+         * @details Just moves the arenas.
+         *
+         * @param other Other frame arena.
+         */
+        FrameArena(FrameArena&& other) noexcept;
+        FrameArena(FrameArena const&) = delete;
+
+        /// @copydoc FrameArena(FrameArena&&)
+        FrameArena& operator=(FrameArena&& other) noexcept;
+        FrameArena& operator=(FrameArena const&) = delete;
+
+        /// @brief Destroys frame arena.
+        ~FrameArena() noexcept;
+
+        /**
+         * @brief Returns local arena.
+         * @details Returns the arena of the calling thread slot.
+         *
+         * @throw std::out_of_range If the calling thread slot is out of
+         * the slots range.
+         *
+         * @return Reference to the arena.
+         */
+        [[nodiscard]] LinearArena& local();
+
+        /**
+         * @brief Returns slot arena.
+         * @details Returns the arena of the specific slot.
+         *
+         * @param slot Index of the slot.
+         *
+         * @return Reference to the arena.
+         */
+        [[nodiscard]] LinearArena& operator[](std::size_t slot) noexcept;
+
+        /// @copydoc operator[](std::size_t)
+        [[nodiscard]] LinearArena const& operator[](std::size_t slot) const noexcept;
+
+        /**
+         * @brief Returns slots count.
+         * @details Returns the count of the arenas.
+         *
+         * @return Count of the slots.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * @brief Resets arenas.
+         * @details Frees the memory allocated from all the arenas.
+         *
+         * @throw std::bad_alloc If allocation of a merged block fails.
+         */
+        void reset();
+
+        /**
+         * @brief Returns high-water mark.
+         * @details Returns the sum of the high-water marks of the arenas.
+         *
+         * @return High-water mark in bytes.
+         */
+        [[nodiscard]] std::size_t high_water() const noexcept;
+
+    private:
+        std::unique_ptr<Slot[]> mySlots;
+        std::size_t mySize;
+    };
+}
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef COLI_GENERIC_FRAME_COMMANDS_H
+#define COLI_GENERIC_FRAME_COMMANDS_H
+
+#include "coli/utility.h"
+#include "coli/game/command_buffer.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Frame commands.
+     * @details Command buffers for the structural changes made while
+     * the systems are executed, one per worker pool slot. The engine
+     * flushes them after the systems of every frame, so the systems may
+     * record changes from any worker without locks. Use @ref local()
+     * to get the buffer of the calling thread.
+     *
+     * @note Each thread must only use its own buffer. Other access
+     * requires external synchronization.
+     */
+    class COLI_EXPORT FrameCommands final
+    {
+        struct alignas(Utility::cache_line_size) Slot {
+            Game::CommandBuffer buffer;
+        };
+
+    public:
+        /**
+         * @brief Creates frame commands.
+         * @details Creates the buffers for the specific count of slots.
+         *
+         * @param slots Count of the worker pool slots.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        explicit FrameCommands(std::size_t slots = 1);
+
+        /**
+         * @brief Moves frame commands.
+         * @details Just moves the buffers.
+         *
+         * @param other Other frame commands.
+         */
+        FrameCommands(FrameCommands&& other) noexcept;
+        FrameCommands(FrameCommands const&) = delete;
+
+        /// @copydoc FrameCommands(FrameCommands&&)
+        FrameCommands& operator=(FrameCommands&& other) noexcept;
+        FrameCommands& operator=(FrameCommands const&) = delete;
+
+        /// @brief Destroys frame commands.
+        ~FrameCommands() noexcept;
+
+        /**
+         * @brief Returns local buffer.
+         * @details Returns the buffer of the calling thread slot.
+         *
+         * @throw std::out_of_range If the calling thread slot is out of
+         * the slots range.
+         *
+         * @return Reference to the buffer.
+         */
+        [[nodiscard]] Game::CommandBuffer& local();
+
+        /**
+         * @brief Returns slot buffer.
+         * @details Returns the buffer of the specific slot.
+         *
+         * @param slot Index of the slot.
+         *
+         * @return Reference to the buffer.
+         */
+        [[nodiscard]] Game::CommandBuffer& operator[](std::size_t slot) noexcept;
+
+        /// @copydoc operator[](std::size_t)
+        [[nodiscard]] Game::CommandBuffer const& operator[](std::size_t slot) const noexcept;
+
+        /**
+         * @brief Returns slots count.
+         * @details Returns the count of the buffers.
+         *
+         * @return Count of the slots.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * @brief Binds scene.
+         * @details Binds all the buffers to the scene.
+         *
+         * @param scene Scene to record the changes of.
+         */
+        void bind(Game::Scene& scene) noexcept;
+
+        /**
+         * @brief Flushes buffers.
+         * @details Applies the commands of all the buffers to the scene,
+         * grouped by the component type, and clears the buffers.
+         *
+         * @param scene Scene to apply the commands to.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw Any Exceptions of the component constructors.
+         */
+        void flush(Game::Scene& scene);
+
+    private:
+        std::unique_ptr<Slot[]> mySlots;
+        std::vector<Game::CommandBuffer*> myBuffers;
+        std::size_t mySize;
+    };
+}
+
+#endif
@@ -0,0 +1,285 @@
+#ifndef COLI_GENERIC_PARALLEL_SYSTEM_H
+#define COLI_GENERIC_PARALLEL_SYSTEM_H
+
+#include "coli/generic/system.h"
+#include "coli/generic/worker_pool.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Per slot values.
+     * @details Stores a separate value for every slot of a worker pool.
+     * Each value is placed on its own cache line, so the threads can
+     * accumulate into their values without atomics and false sharing.
+     *
+     * @tparam T Type of the values.
+     *
+     * @note Each thread must access only the value of its own slot.
+     */
+    template <class T>
+    class SlotLocal final
+    {
+        struct alignas(Utility::cache_line_size) Slot {
+            T value;
+        };
+
+    public:
+        /**
+         * @brief Resets values.
+         * @details Replaces all the values with the specific count
+         * of the initial values.
+         *
+         * @param count Count of the slots;
+         * @param value Initial value.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw T Any T copy constructor exception.
+         */
+        void reset(std::size_t count, T const& value = T())
+        {
+            mySlots.clear();
+            mySlots.resize(count, Slot { value });
+        }
+
+        /**
+         * @brief Returns local value.
+         * @details Returns the value of the calling thread slot.
+         *
+         * @throw std::out_of_range If the calling thread slot is out of
+         * the slots range.
+         *
+         * @return Reference to the value.
+         */
+        [[nodiscard]] T& local() {
+            return mySlots[WorkerPool::current_slot(mySlots.size())].value;
+        }
+
+        /**
+         * @brief Returns slot value.
+         * @details Returns the value of the specific slot.
+         *
+         * @param slot Index of the slot.
+         *
+         * @return Reference to the value.
+         */
+        [[nodiscard]] T& operator[](std::size_t slot) noexcept {
+            return mySlots[slot].value;
+        }
+
+        /// @copydoc operator[](std::size_t)
+        [[nodiscard]] T const& operator[](std::size_t slot) const noexcept {
+            return mySlots[slot].value;
+        }
+
+        /**
+         * @brief Returns slots count.
+         * @details Returns the count of the stored values.
+         *
+         * @return Count of the values.
+         */
+        [[nodiscard]] std::size_t size() const noexcept {
+            return mySlots.size();
+        }
+
+        /**
+         * @brief Combines values.
+         * @details Folds all the values in the slots order.
+         *
+         * @tparam Op Type of the folding operation.
+         *
+         * @param init Initial value of the fold;
+         * @param op Folding operation.
+         *
+         * @return Result of the fold.
+         */
+        template <class Op>
+            requires (std::is_invocable_r_v<T, Op&, T, T const&>)
+        [[nodiscard]] T combine(T init, Op op) const
+        {
+            for (auto const& slot : mySlots)
+                init = op(std::move(init), slot.value);
+
+            return init;
+        }
+
+    private:
+        std::vector<Slot> mySlots;
+    };
+
+    /**
+     * @brief Base for parallel systems.
+     * @details Processes the objects in chunks on the worker pool. The
+     * processing of an object must not touch the other objects. After all
+     * the chunks have finished, the system reduces its slots and updates
+     * once on the executing thread.
+     *
+     * The components list is the same as of SystemBase, e.g. optional
+     * components as pointers, exclusions and owned components. All the
+     * objects are processed every execution, so the budget run policy
+     * is not supported.
+     *
+     * @tparam ComponentTys Required, owned, optional and excluded components.
+     *
+     * @note Interface base. No direct instances are allowed.
+     */
+    template <class... ComponentTys>
+        requires (sizeof...(ComponentTys) > 0)
+    class COLI_EXPORT ParallelSystemBase :
+        public SystemBase<ComponentTys...>
+    {
+        using signature_type = Detail::Signature<ComponentTys...>;
+
+        template <class... Types>
+        [[nodiscard]] static constexpr std::size_t chunk_size_of(Detail::TypeList<Types...>) noexcept
+        {
+            auto const size = std::max<std::size_t>((std::size_t { 0 } + ... + sizeof(std::remove_cv_t<Types>)), 1);
+            return std::max<std::size_t>(Utility::cache_line_size, 16384 / size / Utility::cache_line_size * Utility::cache_line_size);
+        }
+
+        template <class View, class Storages, class Entity>
+        void process_chunks(WorkerPool& workers, View const& objects, Storages const& storages, std::size_t const size, Entity const& entity_at)
+        {
+            std::atomic<std::size_t> processed = 0;
+
+            auto const process = [this] (auto&&... components) {
+                this->process(components...);
+            };
+
+            workers.parallel_for(0, size, chunk_size(),
+                [&] (std::size_t const first, std::size_t const last)
+                {
+                    std::size_t count = 0;
+
+                    for (auto i = first; i < last; ++i)
+                        if (auto const entity = entity_at(i); entity != entt::null) {
+                            signature_type::invoke(objects, storages, entity, process);
+                            ++count;
+                        }
+
+                    processed.fetch_add(count, std::memory_order_relaxed);
+                });
+
+            this->count_processed(processed.load(std::memory_order_relaxed));
+        }
+
+    protected:
+        /**
+         * @brief Default count of objects in a chunk.
+         * @details Chunks cover about 16 KiB of the required components.
+         * The count is a multiple of the cache line size, so neighbouring
+         * chunks never share cache lines of the component arrays.
+         */
+        static constexpr std::size_t default_chunk_size = chunk_size_of(typename signature_type::required_type {});
+
+        /**
+         * @detail Creates parallel system base.
+         * @details Default constructor. Call it from your
+         * derived classes.
+         */
+        ParallelSystemBase() noexcept = default;
+
+    public:
+        /**
+         * @detail Copies parallel system base.
+         * @details Has the default implementation.
+         */
+        ParallelSystemBase(ParallelSystemBase const&) noexcept = default;
+
+        /**
+         * @detail Moves parallel system base.
+         * @details Has the default implementation.
+         */
+        ParallelSystemBase(ParallelSystemBase&&) noexcept = default;
+
+        /// @copydoc ParallelSystemBase(ParallelSystemBase const&)
+        ParallelSystemBase& operator=(ParallelSystemBase const&) noexcept = default;
+
+        /// @copydoc ParallelSystemBase(ParallelSystemBase&&)
+        ParallelSystemBase& operator=(ParallelSystemBase&&) noexcept = default;
+
+        /**
+         * @detail Destroys parallel system base.
+         * @details Has the default implementation.
+         */
+        ~ParallelSystemBase() noexcept override = default;
+
+        /**
+         * @brief Returns chunk size.
+         * @details Returns the count of objects processed by one job.
+         *
+         * @return Count of objects in a chunk.
+         */
+        [[nodiscard]] virtual std::size_t chunk_size() const noexcept {
+            return default_chunk_size;
+        }
+
+        /**
+         * @brief Prepares slots.
+         * @details Calls once per frame before processing. Override it
+         * to reset the per slot accumulators, e.g. a SlotLocal.
+         *
+         * @param count Count of the slots processing may run on.
+         */
+        virtual void reserve_slots([[maybe_unused]] std::size_t count) {}
+
+        /**
+         * @brief Reduces slot.
+         * @details Calls once per frame for each slot in order
+         * after all the objects have been processed, and before
+         * the update.
+         *
+         * @param slot Index of the slot to reduce.
+         */
+        virtual void reduce([[maybe_unused]] std::size_t slot) {}
+
+        /**
+         * @brief Checks budget support.
+         * @details All the objects are processed at once, so the system
+         * cannot run within a time budget.
+         * @note The user should not use this method.
+         */
+        [[nodiscard]] bool supports_budget() const noexcept override {
+            return false;
+        }
+
+        /**
+         * @brief Executes the system.
+         * @note The user should not use this method.
+         */
+        void execute(Game::Scene& scene, Frame const& frame) override
+        {
+            auto& workers = frame.workers();
+            auto objects = signature_type::view(scene);
+            auto const storages = signature_type::storages(scene);
+
+            this->reserve_slots(workers.slot_count());
+
+            if constexpr (Detail::is_group<decltype(objects)>)
+            {
+                // Every object of an owning group matches it.
+                auto const begin = objects.begin();
+
+                process_chunks(workers, objects, storages, objects.size(), [&begin] (std::size_t const index) -> entt::entity {
+                    return begin[static_cast<std::ptrdiff_t>(index)];
+                });
+            }
+            else
+            {
+                auto const* const handle = objects.handle();
+
+                process_chunks(workers, objects, storages, handle ? handle->size() : 0, [&objects, handle] (std::size_t const index) -> entt::entity {
+                    auto const entity = handle->data()[index];
+                    return objects.contains(entity) ? entity : entt::null;
+                });
+            }
+
+            for (std::size_t slot = 0; slot < workers.slot_count(); ++slot)
+                this->reduce(slot);
+
+            this->update();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef COLI_GENERIC_REACTIVE_SYSTEM_H
+#define COLI_GENERIC_REACTIVE_SYSTEM_H
+
+#include "coli/generic/system.h"
+#include "coli/game/observer.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Base for reactive systems.
+     * @details Works like SystemBase, but processes only the objects
+     * whose required components were added, replaced or patched since
+     * the previous execution, e.g. via `ObjectHandle::patch()` or
+     * a command buffer. When nothing has changed, neither `process`
+     * nor `update` is called. On the first execution in a scene, all
+     * the objects are processed.
+     *
+     * The changed objects are processed at once, so the budget run
+     * policy is not supported.
+     *
+     * Patches made while processing are processed in the next frame.
+     * The objects may be patched by other systems on the worker pool
+     * threads at the same time, the changes are collected at the start
+     * of the execution.
+     *
+     * @tparam ComponentTys Required and observed components. Optional,
+     * excluded and owned components are not supported.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     *
+     * @note Interface base. No direct instances are allowed.
+     */
+    template <class... ComponentTys>
+        requires (sizeof...(ComponentTys) > 0 && Detail::Signature<ComponentTys...>::is_plain
+            && std::same_as<typename Detail::Signature<ComponentTys...>::excluded_type, Detail::TypeList<>>)
+    class COLI_EXPORT ReactiveSystemBase :
+        public Detail::SystemBase
+    {
+        using observer_type = Game::Observer<std::remove_cv_t<ComponentTys>...>;
+
+    protected:
+        /**
+         * @detail Creates reactive system base.
+         * @details Default constructor. Call it from your
+         * derived classes.
+         */
+        ReactiveSystemBase() noexcept = default;
+
+    public:
+        /**
+         * @detail Copies reactive system base.
+         * @details Copies the system without its observer, so the copy
+         * processes all the objects on the first execution.
+         */
+        ReactiveSystemBase(ReactiveSystemBase const&) noexcept {}
+
+        /**
+         * @detail Moves reactive system base.
+         * @details Has the default implementation.
+         */
+        ReactiveSystemBase(ReactiveSystemBase&&) noexcept = default;
+
+        /// @copydoc ReactiveSystemBase(ReactiveSystemBase const&)
+        ReactiveSystemBase& operator=(ReactiveSystemBase const&) noexcept
+        {
+            myObserver.reset();
+            return *this;
+        }
+
+        /// @copydoc ReactiveSystemBase(ReactiveSystemBase&&)
+        ReactiveSystemBase& operator=(ReactiveSystemBase&&) noexcept = default;
+
+        /**
+         * @detail Destroys reactive system base.
+         * @details Has the default implementation.
+         */
+        ~ReactiveSystemBase() noexcept override = default;
+
+        /**
+         * @brief Processes components in one changed object.
+         * @details Processes the user-required components in an object
+         * whose components have changed since the previous execution.
+         *
+         * @param components Required components to process.
+         */
+        virtual void process(ComponentTys&... components) = 0;
+
+        /**
+         * @brief Updates system.
+         * @details Updates the system. Calls once per frame after
+         * processing the changed objects, if there are any.
+         */
+        virtual void update() = 0;
+
+        /**
+         * @brief Returns components access.
+         * @details Declares the required components. Const qualified
+         * components are read, others are written.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Access of the system.
+         */
+        [[nodiscard]] SystemAccess access() const override {
+            return Detail::Signature<ComponentTys...>::access();
+        }
+
+        /**
+         * @brief Prepares the system.
+         * @details Creates the observer with the slots of the pool
+         * the patching systems run on.
+         * @note The user should not use this method.
+         */
+        void prepare(Game::Scene& scene, Frame const& frame) override
+        {
+            auto const slots = frame.workers().slot_count();
+
+            Detail::Signature<ComponentTys...>::prepare(scene);
+
+            if (!myObserver || !myObserver->observes(scene))
+            {
+                myObserver.reset();
+                myObserver = std::make_unique<observer_type>(scene, slots);
+            }
+            else if (myObserver->slot_count() != slots)
+                myObserver->resize(slots);
+        }
+
+        /**
+         * @brief Executes the system.
+         * @note The user should not use this method.
+         */
+        void execute(Game::Scene& scene, Frame const&) override
+        {
+            myObserver->collect();
+
+            if (myObserver->empty())
+                return;
+
+            auto const changed = myObserver->changed();
+            myChanged.assign(changed.begin(), changed.end());
+            myObserver->clear();
+
+            auto objects = Detail::Signature<ComponentTys...>::view(scene);
+            std::size_t count = 0;
+
+            for (auto const entity : myChanged)
+                if (objects.contains(entity))
+                {
+                    this->process(objects.template get<ComponentTys>(entity)...);
+                    ++count;
+                }
+
+            this->count_processed(count);
+            this->update();
+        }
+
+    private:
+        std::unique_ptr<observer_type> myObserver;
+        std::vector<entt::entity> myChanged;
+    };
+}
+
+#endif
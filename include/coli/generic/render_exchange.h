@@ -0,0 +1,222 @@
+#ifndef COLI_GENERIC_RENDER_EXCHANGE_H
+#define COLI_GENERIC_RENDER_EXCHANGE_H
+
+#include "coli/utility.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Render snapshot.
+     * @details Render-relevant state of a frame extracted from a scene,
+     * e.g. model matrices and mesh and material handles. The layout of
+     * the items is chosen by the user, keep them small and trivially
+     * copyable. The items keep their capacity between frames.
+     *
+     * @tparam Item Type of the extracted items.
+     */
+    template <class Item>
+    struct RenderSnapshot final
+    {
+        /// @brief Extracted items.
+        std::vector<Item> items;
+
+        /// @brief Index of the extracted frame.
+        std::uint64_t frame = 0;
+
+        /// @brief Interpolation factor of the extracted frame.
+        Types::float_type alpha = 1;
+    };
+
+    /**
+     * @brief Render exchange.
+     * @details Double-buffered render snapshots shared by the game
+     * thread and a render thread. The game thread writes the snapshot
+     * of frame N+1 while the render thread submits the one of frame N.
+     * Writing waits only if the render thread still reads the buffer
+     * to write, so the render lags the simulation by one frame at most.
+     *
+     * The game thread calls @ref write() and @ref publish(), usually
+     * via an `ExtractSystemBase`. The render thread calls @ref acquire()
+     * and @ref release().
+     *
+     * @tparam Item Type of the extracted items.
+     *
+     * @note Thread-safe for one writing and one reading thread.
+     */
+    template <class Item>
+    class COLI_EXPORT RenderExchange final
+    {
+        static constexpr std::size_t none = 2;
+
+    public:
+        /// @brief Type of the snapshots.
+        using snapshot_type = RenderSnapshot<Item>;
+
+        /**
+         * @brief Creates render exchange.
+         * @details Creates the exchange with both buffers empty.
+         */
+        RenderExchange() noexcept = default;
+
+        RenderExchange(RenderExchange&&) = delete;
+        RenderExchange(RenderExchange const&) = delete;
+
+        RenderExchange& operator=(RenderExchange&&) = delete;
+        RenderExchange& operator=(RenderExchange const&) = delete;
+
+        /**
+         * @brief Destroys render exchange.
+         * @details The threads must not use it anymore.
+         */
+        ~RenderExchange() noexcept = default;
+
+        /**
+         * @brief Begins writing.
+         * @details Returns the buffer that is not published. Waits while
+         * the render thread reads it. The previous content is kept, clear
+         * the items before extraction.
+         *
+         * @return Snapshot to write.
+         */
+        [[nodiscard]] snapshot_type& write()
+        {
+            std::unique_lock lock { myMutex };
+
+            myCondition.wait(lock, [this] {
+                return myReading != back();
+            });
+
+            return myBuffers[back()];
+        }
+
+        /**
+         * @brief Publishes written snapshot.
+         * @details Makes the written buffer the latest snapshot
+         * and wakes the render thread.
+         */
+        void publish()
+        {
+            {
+                std::lock_guard const lock { myMutex };
+
+                myPublished = back();
+                myIsFresh = true;
+            }
+
+            myCondition.notify_all();
+        }
+
+        /**
+         * @brief Acquires latest snapshot.
+         * @details Waits for a snapshot that has not been acquired yet and
+         * locks it for reading until @ref release(). The game thread may
+         * write the other buffer meanwhile.
+         *
+         * @return Pointer to the snapshot.
+         *
+         * @retval Nullptr If the exchange is closed and the last
+         * snapshot has been acquired;
+         * @retval ValidPointer Otherwise.
+         */
+        [[nodiscard]] snapshot_type const* acquire()
+        {
+            std::unique_lock lock { myMutex };
+
+            myCondition.wait(lock, [this] {
+                return myIsFresh || myIsClosed;
+            });
+
+            return lock_fresh();
+        }
+
+        /**
+         * @brief Tries to acquire latest snapshot.
+         * @details Works like @ref acquire(), but does not wait.
+         *
+         * @return Pointer to the snapshot.
+         *
+         * @retval Nullptr If there is no new snapshot;
+         * @retval ValidPointer Otherwise.
+         */
+        [[nodiscard]] snapshot_type const* try_acquire()
+        {
+            std::lock_guard const lock { myMutex };
+            return lock_fresh();
+        }
+
+        /**
+         * @brief Releases acquired snapshot.
+         * @details Allows the game thread to write the acquired buffer.
+         */
+        void release()
+        {
+            {
+                std::lock_guard const lock { myMutex };
+                myReading = none;
+            }
+
+            myCondition.notify_all();
+        }
+
+        /**
+         * @brief Closes exchange.
+         * @details Wakes the render thread waiting for a snapshot. Next
+         * acquisitions return the last published snapshot, if it has not
+         * been acquired yet, and nullptr then. Call it before stopping the
+         * render thread. The acquired snapshot must still be released.
+         */
+        void close()
+        {
+            {
+                std::lock_guard const lock { myMutex };
+                myIsClosed = true;
+            }
+
+            myCondition.notify_all();
+        }
+
+        /**
+         * @brief Checks exchange is closed.
+         * @details Checks @ref close() has been called.
+         *
+         * @return Checking result.
+         *
+         * @retval True If the exchange is closed;
+         * @retval False Otherwise.
+         */
+        [[nodiscard]] bool closed() const
+        {
+            std::lock_guard const lock { myMutex };
+            return myIsClosed;
+        }
+
+    private:
+        [[nodiscard]] std::size_t back() const noexcept {
+            return myPublished == 0 ? 1 : 0;
+        }
+
+        [[nodiscard]] snapshot_type const* lock_fresh() noexcept
+        {
+            if (!myIsFresh)
+                return nullptr;
+
+            myIsFresh = false;
+            myReading = myPublished;
+
+            return std::addressof(myBuffers[myReading]);
+        }
+
+        std::array<snapshot_type, 2> myBuffers;
+
+        mutable std::mutex myMutex;
+        std::condition_variable myCondition;
+
+        std::size_t myPublished = none;
+        std::size_t myReading = none;
+        bool myIsFresh = false;
+        bool myIsClosed = false;
+    };
+}
+
+#endif
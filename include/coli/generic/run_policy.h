@@ -0,0 +1,150 @@
+#ifndef COLI_GENERIC_RUN_POLICY_H
+#define COLI_GENERIC_RUN_POLICY_H
+
+#include "coli/utility.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Run policy of a system.
+     * @details Describes how often a system is executed and how much
+     * of its objects it processes per frame. By default, a system
+     * processes all its objects every frame.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT RunPolicy final
+    {
+        [[noreturn]] static void fail_invalid_argument(std::string_view msg);
+
+    public:
+        /// @brief Kind of the policy.
+        enum class Mode
+        {
+            /// @brief Executes every frame.
+            Always,
+
+            /// @brief Executes at a fixed rate of the simulated time.
+            Rate,
+
+            /// @brief Executes every specific count of frames.
+            Interval,
+
+            /// @brief Executes every frame within a time budget.
+            Budget
+        };
+
+        /**
+         * @brief Creates default policy.
+         * @details Creates a policy that executes every frame.
+         */
+        RunPolicy() noexcept;
+
+        /**
+         * @brief Copies policy.
+         * @details Has the default implementation.
+         */
+        RunPolicy(RunPolicy const&) noexcept;
+
+        /// @copydoc RunPolicy(RunPolicy const&)
+        RunPolicy& operator=(RunPolicy const&) noexcept;
+
+        /// @brief Destroys policy.
+        ~RunPolicy() noexcept;
+
+        /**
+         * @brief Makes default policy.
+         * @details Executes the system every frame.
+         *
+         * @return Policy.
+         */
+        [[nodiscard]] static RunPolicy always() noexcept;
+
+        /**
+         * @brief Makes rate policy.
+         * @details Executes the system when the simulated time since its
+         * previous execution reaches the period. The first execution is
+         * in the first frame. At most one execution per frame.
+         *
+         * @param hertz Executions per second of the simulated time.
+         *
+         * @throw std::invalid_argument If the rate is not positive.
+         *
+         * @return Policy.
+         */
+        [[nodiscard]] static RunPolicy rate(Types::float_type hertz);
+
+        /**
+         * @brief Makes interval policy.
+         * @details Executes the system every specific count of frames.
+         * The first execution is in the first frame.
+         *
+         * @param frames Count of frames between executions.
+         *
+         * @throw std::invalid_argument If the count is zero.
+         *
+         * @return Policy.
+         */
+        [[nodiscard]] static RunPolicy every(std::uint64_t frames);
+
+        /**
+         * @brief Makes budget policy.
+         * @details Executes the system every frame, but processes only
+         * as many objects as fit the time budget. The next frame resumes
+         * from the object the previous one stopped at. The count of objects
+         * is adapted to the measured processing cost. Supported by the
+         * systems that process the objects one by one: `SystemBase` and
+         * `StaticSystem`. Other systems process all their objects.
+         *
+         * @param time Time budget per frame.
+         *
+         * @throw std::invalid_argument If the budget is not positive.
+         *
+         * @return Policy.
+         */
+        [[nodiscard]] static RunPolicy budget(std::chrono::nanoseconds time);
+
+        /**
+         * @brief Returns mode.
+         * @details Returns the kind of the policy.
+         *
+         * @return Mode of the policy.
+         */
+        [[nodiscard]] Mode mode() const noexcept;
+
+        /**
+         * @brief Returns period.
+         * @details Returns the period of the rate policy.
+         *
+         * @return Period in seconds, or zero for other policies.
+         */
+        [[nodiscard]] Types::float_type period() const noexcept;
+
+        /**
+         * @brief Returns interval.
+         * @details Returns the count of frames between executions.
+         *
+         * @return Count of frames. It is 1 for the policies
+         * other than the interval one.
+         */
+        [[nodiscard]] std::uint64_t frames() const noexcept;
+
+        /**
+         * @brief Returns budget.
+         * @details Returns the time budget per frame.
+         *
+         * @return Time budget, or zero for other policies.
+         */
+        [[nodiscard]] std::chrono::nanoseconds time() const noexcept;
+
+    private:
+        Mode myMode;
+        Types::float_type myPeriod;
+        std::uint64_t myFrames;
+        std::chrono::nanoseconds myTime;
+    };
+}
+
+#endif
@@ -0,0 +1,137 @@
+#ifndef COLI_GENERIC_SCHEDULER_H
+#define COLI_GENERIC_SCHEDULER_H
+
+#include "coli/utility.h"
+#include "coli/generic/system.h"
+#include "coli/generic/frame.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Timing of a system.
+     * @details Describes the last execution of a scheduled system.
+     */
+    struct COLI_EXPORT SystemTiming final
+    {
+        /// @brief Executed system.
+        Detail::SystemBase const* system = nullptr;
+
+        /// @brief Wall time of the execution.
+        std::chrono::nanoseconds time = std::chrono::nanoseconds::zero();
+
+        /// @brief Count of the processed objects.
+        std::size_t processed = 0;
+    };
+
+    /**
+     * @brief Systems scheduler.
+     * @details Builds a dependency graph of the systems from their
+     * components access. Systems that do not conflict are executed at
+     * the same time on a worker pool. Conflicting systems are executed
+     * in the order they were added.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT Scheduler final
+    {
+        struct Node
+        {
+            std::shared_ptr<Detail::SystemBase> system;
+            SystemAccess access;
+            std::vector<std::size_t> dependents;
+            std::size_t dependencies;
+        };
+
+        struct Execution;
+
+        void rebuild();
+        void run_timed(Game::Scene& scene, Frame const& frame, std::size_t index);
+        void run_node(Execution& execution, std::size_t index) noexcept;
+
+    public:
+        /**
+         * @brief Creates scheduler.
+         * @details Creates a scheduler without systems.
+         */
+        Scheduler() noexcept;
+
+        /**
+         * @brief Moves scheduler.
+         * @details Just moves the scheduler.
+         *
+         * @param other Other scheduler.
+         */
+        Scheduler(Scheduler&& other) noexcept;
+        Scheduler(Scheduler const&) = delete;
+
+        /// @copydoc Scheduler(Scheduler&&)
+        Scheduler& operator=(Scheduler&& other) noexcept;
+        Scheduler& operator=(Scheduler const&) = delete;
+
+        /**
+         * @brief Destroys scheduler.
+         * @details Releases all the scheduled systems.
+         */
+        ~Scheduler() noexcept;
+
+        /**
+         * @brief Adds system.
+         * @details Schedules the system after all the previously added
+         * systems it conflicts with.
+         *
+         * @param system System to schedule.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void add(std::shared_ptr<Detail::SystemBase> system);
+
+        /**
+         * @brief Removes system.
+         * @details Removes the system from the schedule if it was added.
+         *
+         * @param system System to remove.
+         */
+        void remove(Detail::SystemBase const* system) noexcept;
+
+        /**
+         * @brief Returns systems count.
+         * @details Returns the count of the scheduled systems.
+         *
+         * @return Count of the systems.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * @brief Executes systems.
+         * @details Executes all the scheduled systems once on the scene.
+         * Returns when all of them have finished.
+         *
+         * @param scene Scene to process;
+         * @param frame Frame context. The systems are executed on its workers.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw Any The first exception thrown by a system.
+         */
+        void execute(Game::Scene& scene, Frame const& frame);
+
+        /**
+         * @brief Returns timings.
+         * @details Returns the timings of the last execution, one per
+         * system in the adding order. Systems added after the last
+         * execution are not included.
+         *
+         * @return Timings of the systems.
+         */
+        [[nodiscard]] std::span<SystemTiming const> timings() const noexcept;
+
+    private:
+        std::vector<Node> myNodes;
+        std::vector<SystemTiming> myTimings;
+        std::unique_ptr<std::atomic<std::size_t>[]> myRemaining;
+        bool myIsDirty;
+    };
+}
+
+#endif
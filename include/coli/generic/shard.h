@@ -0,0 +1,400 @@
+#ifndef COLI_GENERIC_SHARD_H
+#define COLI_GENERIC_SHARD_H
+
+#include "coli/utility.h"
+#include "coli/generic/system.h"
+#include "coli/generic/scheduler.h"
+#include "coli/generic/stats.h"
+#include "coli/generic/worker_pool.h"
+#include "coli/game/scene.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    class Engine;
+
+    /**
+     * @brief Simulation shard.
+     * @details An isolated world simulated by the engine: a scene with its
+     * own systems, tick rate, frame arena, command buffers, event bus,
+     * timers and statistics. The engine steps its shards in parallel on the worker
+     * pool, so one process can host many independent scenes. The systems
+     * of a shard are never executed by another one.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization. Must not be modified while
+     * the engine is running.
+     */
+    class COLI_EXPORT Shard final
+    {
+        [[noreturn]] static void fail_already_exist();
+        [[noreturn]] static void fail_invalid_step();
+
+        friend class Engine;
+
+        using clock_type = std::chrono::steady_clock;
+
+        template <class T>
+        [[nodiscard]] std::shared_ptr<Detail::SystemBase> const* find_slot() const noexcept
+        {
+            auto const index = Detail::SystemIndex::value<T>();
+
+            if (index < mySystems.size() && mySystems[index])
+                return std::addressof(mySystems[index]);
+
+            return nullptr;
+        }
+
+        void resize(std::size_t slots);
+
+        [[nodiscard]] std::size_t advance(std::chrono::nanoseconds delta, std::size_t max_catch_up) noexcept;
+        [[nodiscard]] bool tick(WorkerPool& workers, std::chrono::nanoseconds delta, Types::float_type alpha);
+
+    public:
+        /// @brief Default simulated time of a frame.
+        static constexpr std::chrono::nanoseconds default_step { 16'666'667 };
+
+        /**
+         * @brief Creates shard.
+         * @details Creates a shard of the scene without systems.
+         *
+         * @param scene Scene to simulate;
+         * @param step Simulated time of a frame of the shard.
+         *
+         * @throw std::invalid_argument If the step is not positive;
+         * @throw std::bad_alloc If allocation fails.
+         */
+        explicit Shard(std::weak_ptr<Game::Scene> scene = {}, std::chrono::nanoseconds step = default_step);
+
+        /**
+         * @brief Moves shard.
+         * @details Just moves the shard.
+         *
+         * @param other Other shard.
+         */
+        Shard(Shard&& other) noexcept;
+        Shard(Shard const&) = delete;
+
+        /// @copydoc Shard(Shard&&)
+        Shard& operator=(Shard&& other) noexcept;
+        Shard& operator=(Shard const&) = delete;
+
+        /**
+         * @brief Destroys shard.
+         * @details Destroys the systems and loses the scene reference.
+         */
+        ~Shard() noexcept;
+
+        /**
+         * @brief Returns scene.
+         * @details Returns the simulated scene.
+         *
+         * @return Weak smart pointer to the scene.
+         */
+        [[nodiscard]] std::weak_ptr<Game::Scene> scene() const noexcept;
+
+        /**
+         * @brief Sets scene.
+         * @details Sets the scene to simulate.
+         *
+         * @param scene New scene weak pointer. Pass expired one
+         * to stop the simulation of the shard.
+         */
+        void scene(std::weak_ptr<Game::Scene> scene) noexcept;
+
+        /**
+         * @brief Returns step.
+         * @details Returns the simulated time of a frame of the shard.
+         *
+         * @return Step of the shard.
+         */
+        [[nodiscard]] std::chrono::nanoseconds step() const noexcept;
+
+        /**
+         * @brief Sets step.
+         * @details Sets the simulated time of a frame of the shard.
+         * The shard is stepped as many times as its steps fit the
+         * time simulated by the engine.
+         *
+         * @param step New step.
+         *
+         * @throw std::invalid_argument If the step is not positive.
+         */
+        void step(std::chrono::nanoseconds step);
+
+        /**
+         * @brief Returns frame index.
+         * @details Returns the count of frames executed by the shard.
+         *
+         * @return Count of frames.
+         */
+        [[nodiscard]] std::uint64_t frames() const noexcept;
+
+        /**
+         * @brief Makes system.
+         * @detail Makes a system of the specific type and returns a weak smart pointer to it.
+         *
+         * @tparam T Type of system to add. It must be derived from Coli::Generic::SystemBase;
+         * @tparam Args Types of T constructor arguments.
+         *
+         * @param args Arguments to a T type constructor.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw std::logic_error If the system are already exists;
+         * @throw T Any of T(Args...) constructor exceptions.
+         *
+         * @return A weak pointer to the newly created system.
+         */
+        template <std::derived_from<Detail::SystemBase> T, class... Args>
+            requires (std::constructible_from<std::remove_cvref_t<T>, Args...>)
+        std::weak_ptr<std::remove_cvref_t<T>> make_system(Args&&... args)
+        {
+            using type = std::remove_cvref_t<T>;
+
+            auto const index = Detail::SystemIndex::value<type>();
+
+            if (index < mySystems.size() && mySystems[index])
+                fail_already_exist();
+
+            if (index >= mySystems.size())
+                mySystems.resize(index + 1);
+
+            auto newSystem = std::make_shared<type>(std::forward<Args>(args)...);
+
+            myScheduler.add(newSystem);
+            mySystems[index] = newSystem;
+
+            return newSystem;
+        }
+
+        /**
+         * @brief Makes system with run policy.
+         * @detail Makes a system of the specific type that is executed
+         * according to the policy, e.g. at a fixed rate or within a time
+         * budget, and returns a weak smart pointer to it.
+         *
+         * @tparam T Type of system to add. It must be derived from Coli::Generic::SystemBase;
+         * @tparam Args Types of T constructor arguments.
+         *
+         * @param policy Run policy of the system;
+         * @param args Arguments to a T type constructor.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw std::invalid_argument If the system does not support the policy;
+         * @throw std::logic_error If the system are already exists;
+         * @throw T Any of T(Args...) constructor exceptions.
+         *
+         * @return A weak pointer to the newly created system.
+         */
+        template <std::derived_from<Detail::SystemBase> T, class... Args>
+            requires (std::constructible_from<std::remove_cvref_t<T>, Args...>)
+        std::weak_ptr<std::remove_cvref_t<T>> make_system(RunPolicy const& policy, Args&&... args)
+        {
+            auto newSystem = make_system<T>(std::forward<Args>(args)...);
+
+            try {
+                newSystem.lock()->run_policy(policy);
+            }
+            catch (...) {
+                remove_system<T>();
+                throw;
+            }
+
+            return newSystem;
+        }
+
+        /**
+         * @brief Gets system.
+         * @detail Returns the system of the specific type if
+         * the shard contains some.
+         *
+         * @tparam T Type of system to get. It must be derived from Coli::Generic::SystemBase.
+         *
+         * @return A weak smart pointer to the system.
+         *
+         * @retval Valid If there is a system of this type;
+         * @retval Expired If no systems of the T type.
+         */
+        template <std::derived_from<Detail::SystemBase> T>
+        [[nodiscard]] std::weak_ptr<std::remove_cvref_t<T> const> get_system() const noexcept
+        {
+            using type = std::remove_cvref_t<T>;
+
+            if (auto const* const system = find_slot<type>())
+                return std::static_pointer_cast<type const>(*system);
+
+            return {};
+        }
+
+        /// @copydoc get_system() const
+        template <std::derived_from<Detail::SystemBase> T>
+        [[nodiscard]] std::weak_ptr<std::remove_cvref_t<T>> get_system() noexcept
+        {
+            using type = std::remove_cvref_t<T>;
+
+            if (auto const* const system = find_slot<type>())
+                return std::static_pointer_cast<type>(*system);
+
+            return {};
+        }
+
+        /**
+         * @brief Finds system.
+         * @detail Returns the system of the specific type if
+         * the shard contains some. Unlike @ref get_system(),
+         * does not touch the reference counters, so it is cheap enough
+         * for hot paths. The pointer is valid until the system is removed.
+         *
+         * @tparam T Type of system to find. It must be derived from Coli::Generic::SystemBase.
+         *
+         * @return A pointer to the system.
+         *
+         * @retval Valid If there is a system of this type;
+         * @retval Null If no systems of the T type.
+         */
+        template <std::derived_from<Detail::SystemBase> T>
+        [[nodiscard]] std::remove_cvref_t<T> const* find_system() const noexcept
+        {
+            using type = std::remove_cvref_t<T>;
+
+            if (auto const* const system = find_slot<type>())
+                return static_cast<type const*>(system->get());
+
+            return nullptr;
+        }
+
+        /// @copydoc find_system() const
+        template <std::derived_from<Detail::SystemBase> T>
+        [[nodiscard]] std::remove_cvref_t<T>* find_system() noexcept {
+            return const_cast<std::remove_cvref_t<T>*>(std::as_const(*this).find_system<T>());
+        }
+
+        /**
+         * @brief Destroys system.
+         * @detail Destroys the system of the specific type if
+         * the shard contains some.
+         *
+         * @tparam T Type of system to destroy. It must be derived from Coli::Generic::SystemBase.
+         */
+        template <std::derived_from<Detail::SystemBase> T>
+        void remove_system() noexcept
+        {
+            using type = std::remove_cvref_t<T>;
+
+            if (auto const index = Detail::SystemIndex::value<type>(); index < mySystems.size()) {
+                myScheduler.remove(mySystems[index].get());
+                mySystems[index].reset();
+            }
+        }
+
+        /**
+         * @brief Returns frame arena.
+         * @details Returns the arena for the allocations that live no
+         * longer than a frame of the shard.
+         *
+         * @return Frame arena.
+         */
+        [[nodiscard]] FrameArena& arena() noexcept;
+
+        /// @copydoc arena()
+        [[nodiscard]] FrameArena const& arena() const noexcept;
+
+        /**
+         * @brief Returns frame commands.
+         * @details Returns the command buffers flushed after
+         * the systems of every frame of the shard.
+         *
+         * @return Frame commands.
+         */
+        [[nodiscard]] FrameCommands& commands() noexcept;
+
+        /**
+         * @brief Returns event bus.
+         * @details Returns the bus of the systems of the shard,
+         * swapped after every frame of the shard.
+         *
+         * @return Event bus.
+         */
+        [[nodiscard]] EventBus& events() noexcept;
+
+        /// @copydoc events()
+        [[nodiscard]] EventBus const& events() const noexcept;
+
+        /**
+         * @brief Returns frame timers.
+         * @details Returns the timers of the systems of the shard,
+         * advanced by one tick at the beginning of every frame
+         * of the shard.
+         *
+         * @return Frame timers.
+         */
+        [[nodiscard]] FrameTimers& timers() noexcept;
+
+        /// @copydoc timers()
+        [[nodiscard]] FrameTimers const& timers() const noexcept;
+
+        /**
+         * @brief Returns frame statistics.
+         * @details Returns the statistics of the last frames of the shard.
+         *
+         * @return Frame statistics.
+         */
+        [[nodiscard]] FrameStats const& stats() const noexcept;
+
+        /**
+         * @brief Clears statistics.
+         * @details Drops the recorded statistics.
+         */
+        void clear_stats() noexcept;
+
+        /**
+         * @brief Sets statistics capacity.
+         * @details Drops the recorded statistics and keeps
+         * the specified count of the last frames from now on.
+         *
+         * @param capacity Count of the last frames to keep.
+         *
+         * @throw std::invalid_argument If the capacity is zero;
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void stats_capacity(std::size_t capacity);
+
+        /**
+         * @brief Returns system statistics.
+         * @details Summarizes the time of the system of
+         * the specific type in the last frames.
+         *
+         * @tparam T Type of the system.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Summary of the system. Has no samples if there is
+         * no system of this type or it has not been executed yet.
+         */
+        template <std::derived_from<Detail::SystemBase> T>
+        [[nodiscard]] StatsSummary system_stats() const
+        {
+            if (auto const* const system = find_system<T>())
+                return myStats.system(*system);
+
+            return {};
+        }
+
+    private:
+        std::vector<std::shared_ptr<Detail::SystemBase>> mySystems;
+
+        Scheduler myScheduler;
+        FrameStats myStats;
+        FrameArena myArena;
+        FrameCommands myCommands;
+        EventBus myEvents;
+        FrameTimers myTimers;
+
+        std::weak_ptr<Game::Scene> myScene;
+        std::chrono::nanoseconds myStep;
+        std::chrono::nanoseconds myAccumulated;
+        std::uint64_t myFrameIndex;
+    };
+}
+
+#endif
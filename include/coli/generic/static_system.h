@@ -0,0 +1,128 @@
+#ifndef COLI_GENERIC_STATIC_SYSTEM_H
+#define COLI_GENERIC_STATIC_SYSTEM_H
+
+#include "coli/generic/system.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Base for statically dispatched systems.
+     * @details Works like SystemBase, but calls `process` and `update` of
+     * the derived class directly instead of the virtual calls. It allows
+     * the compiler to inline the processing into the objects loop.
+     * The derived class must provide a public `process` that takes the
+     * components like the one of SystemBase, and may provide a public
+     * `update`. Like SystemBase, it iterates an owning group if the
+     * components list contains `entt::owned_t`.
+     *
+     * @tparam Derived Type of the derived system;
+     * @tparam ComponentTys Required, owned, optional and excluded components.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     *
+     * @note Interface base. No direct instances are allowed.
+     */
+    template <class Derived, class... ComponentTys>
+        requires (Detail::valid_signature<ComponentTys...>)
+    class COLI_EXPORT StaticSystem :
+        public Detail::SystemBase
+    {
+        using signature_type = Detail::Signature<ComponentTys...>;
+
+    protected:
+        /**
+         * @detail Creates static system base.
+         * @details Default constructor. Call it from your
+         * derived classes.
+         */
+        StaticSystem() noexcept = default;
+
+    public:
+        /**
+         * @detail Copies static system base.
+         * @details Has the default implementation.
+         */
+        StaticSystem(StaticSystem const&) noexcept = default;
+
+        /**
+         * @detail Moves static system base.
+         * @details Has the default implementation.
+         */
+        StaticSystem(StaticSystem&&) noexcept = default;
+
+        /// @copydoc StaticSystem(StaticSystem const&)
+        StaticSystem& operator=(StaticSystem const&) noexcept = default;
+
+        /// @copydoc StaticSystem(StaticSystem&&)
+        StaticSystem& operator=(StaticSystem&&) noexcept = default;
+
+        /**
+         * @detail Destroys static system base.
+         * @details Has the default implementation.
+         */
+        ~StaticSystem() noexcept override = default;
+
+        /**
+         * @brief Returns components access.
+         * @details Declares the required components. Const qualified
+         * components are read, others are written.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Access of the system.
+         */
+        [[nodiscard]] SystemAccess access() const override {
+            return signature_type::access();
+        }
+
+        /**
+         * @brief Checks budget support.
+         * @details The system processes the objects in slices, so it
+         * can run within a time budget.
+         * @note The user should not use this method.
+         */
+        [[nodiscard]] bool supports_budget() const noexcept override {
+            return true;
+        }
+
+        /**
+         * @brief Prepares the system.
+         * @note The user should not use this method.
+         */
+        void prepare(Game::Scene& scene, Frame const&) override {
+            signature_type::prepare(scene);
+        }
+
+        /**
+         * @brief Executes the system.
+         * @note The user should not use this method.
+         */
+        void execute(Game::Scene& scene, Frame const&) final
+        {
+            static_assert(std::derived_from<Derived, StaticSystem>,
+                "the derived type must inherit this system base");
+
+            auto& self = static_cast<Derived&>(*this);
+            auto objects = signature_type::view(scene);
+            auto const storages = signature_type::storages(scene);
+
+            auto const process = [&self] (auto&&... components) {
+                self.process(components...);
+            };
+
+            if (this->run_policy().mode() == RunPolicy::Mode::Budget)
+                this->process_sliced(objects, [&] (entt::entity const entity) {
+                    signature_type::invoke(objects, storages, entity, process);
+                });
+            else
+                this->count_processed(signature_type::each(objects, storages, process));
+
+            if constexpr (requires { self.update(); })
+                self.update();
+        }
+    };
+}
+
+#endif
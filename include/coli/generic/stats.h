@@ -0,0 +1,165 @@
+#ifndef COLI_GENERIC_STATS_H
+#define COLI_GENERIC_STATS_H
+
+#include "coli/utility.h"
+#include "coli/generic/scheduler.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Timing summary.
+     * @details Describes the distribution of the recorded times.
+     * Percentiles are computed with the nearest rank method.
+     */
+    struct COLI_EXPORT StatsSummary final
+    {
+        /// @brief Count of the recorded frames the summary is based on.
+        std::size_t samples = 0;
+
+        /// @brief Median time.
+        std::chrono::nanoseconds p50 = std::chrono::nanoseconds::zero();
+
+        /// @brief 95th percentile time.
+        std::chrono::nanoseconds p95 = std::chrono::nanoseconds::zero();
+
+        /// @brief 99th percentile time.
+        std::chrono::nanoseconds p99 = std::chrono::nanoseconds::zero();
+
+        /// @brief Maximal time.
+        std::chrono::nanoseconds max = std::chrono::nanoseconds::zero();
+
+        /// @brief Average count of the processed objects per frame.
+        std::size_t processed = 0;
+    };
+
+    /**
+     * @brief Frame statistics.
+     * @details Records the frame time and the timings of the systems
+     * into a ring of the last frames. Recording does not lock and does
+     * not allocate while the set of the systems stays the same.
+     *
+     * @note Recording is single-threaded. The frame summary may be
+     * queried from other threads while recording. Other access
+     * requires external synchronization.
+     */
+    class COLI_EXPORT FrameStats final
+    {
+        struct Column
+        {
+            Detail::SystemBase const* system;
+            std::uint64_t since;
+
+            std::unique_ptr<std::atomic<std::int64_t>[]> times;
+            std::unique_ptr<std::atomic<std::size_t>[]> processed;
+        };
+
+        [[noreturn]] static void fail_zero_capacity();
+
+        [[nodiscard]] StatsSummary summarize(
+            std::atomic<std::int64_t> const* times,
+            std::atomic<std::size_t> const* processed,
+            std::uint64_t since) const;
+
+        [[nodiscard]] bool same_systems(std::span<SystemTiming const> systems) const noexcept;
+        void reset_columns(std::span<SystemTiming const> systems);
+
+    public:
+        /// @brief Default count of the recorded frames.
+        static constexpr std::size_t default_capacity = 240;
+
+        /**
+         * @brief Creates frame statistics.
+         * @details Creates empty statistics of the last frames.
+         *
+         * @param capacity Count of the last frames to keep.
+         *
+         * @throw std::invalid_argument If the capacity is zero;
+         * @throw std::bad_alloc If allocation fails.
+         */
+        explicit FrameStats(std::size_t capacity = default_capacity);
+
+        /**
+         * @brief Moves frame statistics.
+         * @details Just moves the statistics.
+         *
+         * @param other Other statistics.
+         */
+        FrameStats(FrameStats&& other) noexcept;
+        FrameStats(FrameStats const&) = delete;
+
+        /// @copydoc FrameStats(FrameStats&&)
+        FrameStats& operator=(FrameStats&& other) noexcept;
+        FrameStats& operator=(FrameStats const&) = delete;
+
+        /// @brief Destroys frame statistics.
+        ~FrameStats() noexcept;
+
+        /**
+         * @brief Returns capacity.
+         * @details Returns the count of the last frames kept.
+         *
+         * @return Capacity of the ring.
+         */
+        [[nodiscard]] std::size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns recorded count.
+         * @details Returns the count of the frames recorded since
+         * creation or the last clearing, including the dropped ones.
+         *
+         * @return Count of the recorded frames.
+         */
+        [[nodiscard]] std::uint64_t recorded() const noexcept;
+
+        /**
+         * @brief Records frame.
+         * @details Records the frame time and the timings of the systems
+         * executed in the frame. If the set of the systems has changed,
+         * the history of the removed systems is dropped.
+         *
+         * @param time Wall time of the frame;
+         * @param systems Timings of the systems.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void record(std::chrono::nanoseconds time, std::span<SystemTiming const> systems);
+
+        /**
+         * @brief Clears statistics.
+         * @details Drops all the recorded frames.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Returns frame summary.
+         * @details Summarizes the time of the kept frames.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Summary of the frames. The processed count is always zero.
+         */
+        [[nodiscard]] StatsSummary frame() const;
+
+        /**
+         * @brief Returns system summary.
+         * @details Summarizes the time of the system in the kept frames.
+         *
+         * @param system System to summarize.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Summary of the system. Has no samples if
+         * the system has not been recorded.
+         */
+        [[nodiscard]] StatsSummary system(Detail::SystemBase const& system) const;
+
+    private:
+        std::size_t myCapacity;
+        std::unique_ptr<std::atomic<std::int64_t>[]> myTimes;
+        std::vector<Column> myColumns;
+        std::atomic<std::uint64_t> myRecorded;
+    };
+}
+
+#endif
@@ -3,6 +3,121 @@
 
 #include "coli/game/object.h"
 #include "coli/game/scene.h"
+#include "coli/generic/frame.h"
+#include "coli/generic/run_policy.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Components access of a system.
+     * @details Describes the component types a system reads and writes.
+     * Two systems conflict if one of them writes a component type the
+     * other one reads or writes. Non-conflicting systems are allowed
+     * to execute at the same time.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT SystemAccess final
+    {
+        [[nodiscard]] static bool intersects(
+            std::vector<entt::id_type> const& first,
+            std::vector<entt::id_type> const& second) noexcept;
+
+        void insert(std::vector<entt::id_type>& ids, entt::id_type id);
+
+    public:
+        /**
+         * @brief Creates exclusive access.
+         * @details Creates an access that conflicts with any other one.
+         * Used for systems that have not declared their components.
+         */
+        SystemAccess() noexcept;
+
+        /**
+         * @brief Copies access.
+         * @details Has the default implementation.
+         */
+        SystemAccess(SystemAccess const&);
+
+        /**
+         * @brief Moves access.
+         * @details Has the default implementation.
+         */
+        SystemAccess(SystemAccess&&) noexcept;
+
+        /// @copydoc SystemAccess(SystemAccess const&)
+        SystemAccess& operator=(SystemAccess const&);
+
+        /// @copydoc SystemAccess(SystemAccess&&)
+        SystemAccess& operator=(SystemAccess&&) noexcept;
+
+        /// @brief Destroys access.
+        ~SystemAccess() noexcept;
+
+        /**
+         * @brief Declares component.
+         * @details Declares access to the component type. Const
+         * qualified types are read, others are written. The front
+         * buffers of the double-buffered components are always read,
+         * and only the back buffers of non-const ones are written.
+         * Makes the access non-exclusive.
+         *
+         * @tparam T Type of the component.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        template <class T>
+        void declare()
+        {
+            using type = std::remove_cvref_t<T>;
+
+            myIsExclusive = false;
+
+            if constexpr (Game::Detail::is_double_buffered<type>)
+            {
+                insert(myReads, entt::type_hash<Game::Detail::FrontBuffer<type>>::value());
+
+                if constexpr (!std::is_const_v<std::remove_reference_t<T>>)
+                    insert(myWrites, entt::type_hash<Game::Detail::BackBuffer<type>>::value());
+            }
+            else if constexpr (std::is_const_v<std::remove_reference_t<T>>)
+                insert(myReads, entt::type_hash<type>::value());
+            else
+                insert(myWrites, entt::type_hash<type>::value());
+        }
+
+        /**
+         * @brief Checks exclusiveness.
+         * @details Checks the access conflicts with any other one.
+         *
+         * @return Checking result.
+         *
+         * @retval True If the access is exclusive;
+         * @retval False Otherwise.
+         */
+        [[nodiscard]] bool is_exclusive() const noexcept;
+
+        /**
+         * @brief Checks conflict.
+         * @details Checks the two accesses cannot be executed at the same time.
+         *
+         * @param other Other access.
+         *
+         * @return Checking result.
+         *
+         * @retval True If the accesses conflict;
+         * @retval False Otherwise.
+         */
+        [[nodiscard]] bool conflicts(SystemAccess const& other) const noexcept;
+
+    private:
+        std::vector<entt::id_type> myReads;
+        std::vector<entt::id_type> myWrites;
+        bool myIsExclusive;
+    };
+}
 
 /**
  * @brief For internal details.
@@ -10,8 +125,31 @@
  */
 namespace Coli::Generic::Detail
 {
+    class COLI_EXPORT SystemIndex final
+    {
+        [[nodiscard]] static std::size_t next() noexcept;
+
+    public:
+        SystemIndex() = delete;
+
+        template <class T>
+        [[nodiscard]] static std::size_t value() noexcept
+        {
+            static std::size_t const index = next();
+            return index;
+        }
+    };
+
+    template <class T>
+    inline constexpr bool is_group = false;
+
+    template <class... Types>
+    inline constexpr bool is_group<entt::basic_group<Types...>> = true;
+
     class COLI_EXPORT SystemBase
     {
+        [[noreturn]] static void fail_unsupported_policy();
+
     protected:
         SystemBase() noexcept;
 
@@ -24,7 +162,361 @@ namespace Coli::Generic::Detail
 
         virtual ~SystemBase() noexcept;
 
-        virtual void execute(Game::Scene& scene) = 0;
+        [[nodiscard]] virtual Generic::SystemAccess access() const;
+
+        [[nodiscard]] virtual bool supports_budget() const noexcept;
+
+        virtual void prepare(Game::Scene& scene, Generic::Frame const& frame);
+        virtual void execute(Game::Scene& scene, Generic::Frame const& frame) = 0;
+
+        void run(Game::Scene& scene, Generic::Frame const& frame);
+
+        [[nodiscard]] std::size_t processed() const noexcept;
+
+        [[nodiscard]] Generic::RunPolicy const& run_policy() const noexcept;
+        void run_policy(Generic::RunPolicy const& policy);
+
+    protected:
+        [[nodiscard]] Generic::Frame const& frame() const noexcept;
+        [[nodiscard]] Types::float_type elapsed() const noexcept;
+
+        void count_processed(std::size_t count) noexcept;
+
+        template <class View, class Func>
+        void process_sliced(View const& objects, Func&& func)
+        {
+            if constexpr (is_group<View>)
+            {
+                // Every object of an owning group matches it.
+                auto const begin = objects.begin();
+
+                process_sliced(objects.size(), func, [&begin] (std::size_t const index) -> entt::entity {
+                    return begin[static_cast<std::ptrdiff_t>(index)];
+                });
+            }
+            else
+            {
+                auto const* const handle = objects.handle();
+
+                process_sliced(handle ? handle->size() : 0, func, [&objects, handle] (std::size_t const index) -> entt::entity {
+                    auto const entity = handle->data()[index];
+                    return objects.contains(entity) ? entity : entt::null;
+                });
+            }
+        }
+
+    private:
+        using clock_type = std::chrono::steady_clock;
+
+        template <class Func, class Entity>
+        void process_sliced(std::size_t const size, Func& func, Entity const& entity_at)
+        {
+            auto const [first, count] = begin_slice(size);
+
+            std::size_t visited = 0;
+            std::size_t processed = 0;
+
+            while (visited < count)
+            {
+                auto const end = std::min(count, visited + slice_check);
+
+                for (; visited < end; ++visited)
+                {
+                    auto const entity = entity_at((first + visited) % size);
+
+                    if (entity != entt::null) {
+                        func(entity);
+                        ++processed;
+                    }
+                }
+
+                if (slice_exhausted())
+                    break;
+            }
+
+            end_slice(visited);
+            count_processed(processed);
+        }
+
+        /// @brief Count of objects processed between the budget checks.
+        static constexpr std::size_t slice_check = 32;
+
+        [[nodiscard]] bool is_due(Types::float_type delta) noexcept;
+
+        [[nodiscard]] std::pair<std::size_t, std::size_t> begin_slice(std::size_t size) noexcept;
+        [[nodiscard]] bool slice_exhausted() const noexcept;
+        void end_slice(std::size_t visited) noexcept;
+
+        Generic::Frame const* myFrame;
+        std::size_t myProcessed;
+
+        Generic::RunPolicy myPolicy;
+        Types::float_type myElapsed;
+        Types::float_type myWaited;
+        std::uint64_t myFrames;
+
+        std::size_t myCursor;
+        std::size_t mySliceSize;
+        double myCost;
+        clock_type::time_point mySliceStart;
+    };
+
+    template <class... Types>
+    struct TypeList {};
+
+    template <class... Lists>
+    struct TypeListCat {
+        using type = TypeList<>;
+    };
+
+    template <class... Types>
+    struct TypeListCat<TypeList<Types...>> {
+        using type = TypeList<Types...>;
+    };
+
+    template <class... First, class... Second, class... Rest>
+    struct TypeListCat<TypeList<First...>, TypeList<Second...>, Rest...> :
+        TypeListCat<TypeList<First..., Second...>, Rest...>
+    {};
+
+    template <class T>
+    using StoragePointer = entt::storage_for_t<std::remove_cvref_t<T>>*;
+
+    template <class T>
+    struct SignatureItem
+    {
+        using required_type = TypeList<T>;
+        using owned_type = TypeList<>;
+        using get_type = TypeList<T>;
+        using optional_type = TypeList<>;
+        using excluded_type = TypeList<>;
+        using argument_type = TypeList<T&>;
+
+        template <class Storages, class Required>
+        [[nodiscard]] static auto argument(Storages const&, entt::entity, Required const& required) noexcept {
+            return std::forward_as_tuple(std::get<T&>(required));
+        }
+    };
+
+    template <class T>
+    struct SignatureItem<T*>
+    {
+        using required_type = TypeList<>;
+        using owned_type = TypeList<>;
+        using get_type = TypeList<>;
+        using optional_type = TypeList<T>;
+        using excluded_type = TypeList<>;
+        using argument_type = TypeList<T*>;
+
+        template <class Storages, class Required>
+        [[nodiscard]] static auto argument(Storages const& storages, entt::entity const entity, Required const&)
+        {
+            auto* const storage = std::get<StoragePointer<T>>(storages);
+            T* const component = storage->contains(entity) ? std::addressof(storage->get(entity)) : nullptr;
+
+            return std::tuple<T*> { component };
+        }
+    };
+
+    template <class... Excluded>
+    struct SignatureItem<entt::exclude_t<Excluded...>>
+    {
+        using required_type = TypeList<>;
+        using owned_type = TypeList<>;
+        using get_type = TypeList<>;
+        using optional_type = TypeList<>;
+        using excluded_type = TypeList<Excluded...>;
+        using argument_type = TypeList<>;
+
+        template <class Storages, class Required>
+        [[nodiscard]] static std::tuple<> argument(Storages const&, entt::entity, Required const&) noexcept {
+            return {};
+        }
+    };
+
+    template <class... Owned>
+    struct SignatureItem<entt::owned_t<Owned...>>
+    {
+        using required_type = TypeList<Owned...>;
+        using owned_type = TypeList<Owned...>;
+        using get_type = TypeList<>;
+        using optional_type = TypeList<>;
+        using excluded_type = TypeList<>;
+        using argument_type = TypeList<Owned&...>;
+
+        template <class Storages, class Required>
+        [[nodiscard]] static auto argument(Storages const&, entt::entity, Required const& required) noexcept {
+            return std::forward_as_tuple(std::get<Owned&>(required)...);
+        }
+    };
+
+    template <class... ComponentTys>
+    class Signature final
+    {
+        template <class... Required, class... Optional, class... Excluded>
+        static void declare(Generic::SystemAccess& access, TypeList<Required...>, TypeList<Optional...>, TypeList<Excluded...>)
+        {
+            (access.declare<Required>(), ...);
+            (access.declare<Optional>(), ...);
+            (access.declare<Excluded const>(), ...);
+        }
+
+        template <class... Types>
+        [[nodiscard]] static std::tuple<StoragePointer<Types>...> storages(Game::Scene& scene, TypeList<Types...>) {
+            return { scene.storage<Types>()... };
+        }
+
+        template <class... Required, class... Excluded>
+        [[nodiscard]] static auto view(Game::Scene& scene, TypeList<Required...>, TypeList<Excluded...>) {
+            return scene.filtered<Required...>(entt::exclude<Excluded...>);
+        }
+
+        template <class... Owned, class... Get, class... Excluded>
+        [[nodiscard]] static auto group(Game::Scene& scene, TypeList<Owned...>, TypeList<Get...>, TypeList<Excluded...>) {
+            return scene.grouped<Owned...>(entt::get<Get...>, entt::exclude<Excluded...>);
+        }
+
+        [[nodiscard]] static auto objects(Game::Scene& scene)
+        {
+            if constexpr (is_grouped)
+                return group(scene, owned_type {}, get_type {}, excluded_type {});
+            else
+                return view(scene, required_type {}, excluded_type {});
+        }
+
+        template <bool Write, class... Required>
+        static void buffers(Game::Scene& scene, TypeList<Required...>)
+        {
+            auto const buffer = [&scene] <class T> (std::type_identity<T>)
+            {
+                if constexpr (Game::Detail::is_double_buffered<std::remove_const_t<T>>)
+                {
+                    auto& state = scene.buffer<typename std::remove_const_t<T>::value_type>();
+
+                    if constexpr (Write && !std::is_const_v<T>)
+                        state.written();
+                }
+            };
+
+            (buffer(std::type_identity<Required> {}), ...);
+        }
+
+        template <class... Types>
+        static void layers(Game::Scene& scene, TypeList<Types...>)
+        {
+            // Only the layers define the order, writing the dependents keeps it.
+            if constexpr ((std::same_as<Types, Game::Components::Layer> || ...))
+                scene.touch_layer_order();
+        }
+
+        template <class View, class Storages, class Func, class... Required>
+        static void invoke(View const& objects, Storages const& storages, entt::entity const entity, Func& func, TypeList<Required...>)
+        {
+            std::apply(func, arguments(storages, entity,
+                std::forward_as_tuple(objects.template get<Required>(entity)...)));
+        }
+
+        template <class Storages, class Required>
+        [[nodiscard]] static auto arguments(Storages const& storages, entt::entity const entity, Required const& required) {
+            return std::tuple_cat(SignatureItem<ComponentTys>::argument(storages, entity, required)...);
+        }
+
+    public:
+        using required_type = typename TypeListCat<typename SignatureItem<ComponentTys>::required_type...>::type;
+        using owned_type = typename TypeListCat<typename SignatureItem<ComponentTys>::owned_type...>::type;
+        using get_type = typename TypeListCat<typename SignatureItem<ComponentTys>::get_type...>::type;
+        using optional_type = typename TypeListCat<typename SignatureItem<ComponentTys>::optional_type...>::type;
+        using excluded_type = typename TypeListCat<typename SignatureItem<ComponentTys>::excluded_type...>::type;
+        using argument_type = typename TypeListCat<typename SignatureItem<ComponentTys>::argument_type...>::type;
+
+        static constexpr bool is_grouped = !std::same_as<owned_type, TypeList<>>;
+
+        // The components of a group are passed in the order of the owned ones first.
+        static constexpr bool is_plain = std::same_as<optional_type, TypeList<>> && !is_grouped;
+
+        Signature() = delete;
+
+        [[nodiscard]] static Generic::SystemAccess access()
+        {
+            Generic::SystemAccess result;
+            declare(result, required_type {}, optional_type {}, excluded_type {});
+
+            return result;
+        }
+
+        static void prepare(Game::Scene& scene)
+        {
+            static_cast<void>(objects(scene));
+            static_cast<void>(storages(scene));
+
+            buffers<false>(scene, required_type {});
+        }
+
+        [[nodiscard]] static auto view(Game::Scene& scene)
+        {
+            // The back buffers are written by whoever views them.
+            buffers<true>(scene, required_type {});
+
+            layers(scene, required_type {});
+            layers(scene, optional_type {});
+
+            return objects(scene);
+        }
+
+        [[nodiscard]] static auto storages(Game::Scene& scene) {
+            return storages(scene, optional_type {});
+        }
+
+        template <class View, class Storages, class Func>
+        static std::size_t each(View const& objects, Storages const& storages, Func&& func)
+        {
+            std::size_t count = 0;
+
+            if constexpr (is_plain)
+                objects.each([&func, &count] (auto&... components) {
+                    func(components...);
+                    ++count;
+                });
+            else
+                objects.each([&storages, &func, &count] (entt::entity const entity, auto&... components) {
+                    std::apply(func, arguments(storages, entity, std::forward_as_tuple(components...)));
+                    ++count;
+                });
+
+            return count;
+        }
+
+        template <class View, class Storages, class Func>
+        static void invoke(View const& objects, Storages const& storages, entt::entity const entity, Func&& func) {
+            invoke(objects, storages, entity, func, required_type {});
+        }
+
+    };
+
+    template <class... ComponentTys>
+    concept valid_signature =
+        !std::same_as<typename Signature<ComponentTys...>::required_type, TypeList<>>;
+
+    template <class Arguments>
+    class SystemProcess;
+
+    template <class... Arguments>
+    class SystemProcess<TypeList<Arguments...>> :
+        public SystemBase
+    {
+    protected:
+        SystemProcess() noexcept = default;
+
+    public:
+        SystemProcess(SystemProcess const&) noexcept = default;
+        SystemProcess(SystemProcess&&) noexcept = default;
+
+        SystemProcess& operator=(SystemProcess const&) noexcept = default;
+        SystemProcess& operator=(SystemProcess&&) noexcept = default;
+
+        ~SystemProcess() noexcept override = default;
+
+        virtual void process(Arguments... components) = 0;
     };
 }
 
@@ -35,6 +527,26 @@ namespace Coli::Generic
      * @brief Base for systems.
      * @details The basic interface of the systems type.
      * Systems used in game engines to process the objects.
+     * Call `frame()` inside `process` and `update` to get
+     * the context of the current frame, e.g. its delta time,
+     * and `elapsed()` to get the simulated time since the previous
+     * execution of the system. The engine executes the system
+     * according to its `RunPolicy`.
+     *
+     * The components list may contain optional components as pointers,
+     * e.g. `Health*`, and exclusions, e.g. `entt::exclude_t<Dead>`. The
+     * objects that have an excluded component are skipped by the view
+     * without calling `process`.
+     *
+     * To iterate an owning group instead of a view, list the components
+     * the group owns in `entt::owned_t`, e.g. `entt::owned_t<Transform3D,
+     * Body>`. They are passed to `process` first, by references, as the
+     * required ones. The other required components are got by the group.
+     * See @ref Game::Scene::grouped() for the ownership conflicts, which
+     * are detected when the system is prepared for the first frame.
+     *
+     * @tparam ComponentTys Required, owned, optional and excluded components.
+     * At least one component must be required.
      *
      * @note Not thread-safe. Concurrent access requires
      * external synchronization.
@@ -42,10 +554,13 @@ namespace Coli::Generic
      * @note Interface base. No direct instances are allowed.
     */
     template <class... ComponentTys>
-        requires (sizeof...(ComponentTys) > 0)
+        requires (Detail::valid_signature<ComponentTys...>)
     class COLI_EXPORT SystemBase :
-        public Detail::SystemBase
+        public Detail::SystemProcess<typename Detail::Signature<ComponentTys...>::argument_type>
     {
+        using signature_type = Detail::Signature<ComponentTys...>;
+        using process_type = Detail::SystemProcess<typename signature_type::argument_type>;
+
     protected:
         /**
          * @detail Creates system base.
@@ -88,12 +603,13 @@ namespace Coli::Generic
         /**
          * @brief Processes components in one object.
          * @details Processes the user-required components in an object.
-         * It calls for each object that has all of required components many
-         * times per frame.
-         *
-         * @param components Required components to process.
+         * It calls for each object that has all of required components
+         * and none of excluded ones many times per frame. The required
+         * components are passed by references, the optional ones by
+         * pointers that are null if the object has not the component.
+         * The excluded components are not passed.
          */
-        virtual void process(ComponentTys&... components) = 0;
+        using process_type::process;
 
         /**
          * @brief Updates system.
@@ -102,17 +618,56 @@ namespace Coli::Generic
          */
         virtual void update() = 0;
 
+        /**
+         * @brief Returns components access.
+         * @details Declares the required components. Const qualified
+         * components are read, others are written.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Access of the system.
+         */
+        [[nodiscard]] SystemAccess access() const override {
+            return signature_type::access();
+        }
+
+        /**
+         * @brief Checks budget support.
+         * @details The system processes the objects in slices, so it
+         * can run within a time budget.
+         * @note The user should not use this method.
+         */
+        [[nodiscard]] bool supports_budget() const noexcept override {
+            return true;
+        }
+
+        /**
+         * @brief Prepares the system.
+         * @note The user should not use this method.
+         */
+        void prepare(Game::Scene& scene, Frame const&) override {
+            signature_type::prepare(scene);
+        }
+
         /**
          * @brief Executes the system.
          * @note The user should not use this method.
          */
-        void execute(Game::Scene& scene) override
+        void execute(Game::Scene& scene, Frame const&) override
         {
-            auto objects = scene.filtered<ComponentTys...>();
+            auto objects = signature_type::view(scene);
+            auto const storages = signature_type::storages(scene);
 
-            objects.each([&] (auto&... components) {
+            auto const process = [this] (auto&&... components) {
                 this->process(components...);
-            });
+            };
+
+            if (this->run_policy().mode() == RunPolicy::Mode::Budget)
+                this->process_sliced(objects, [&] (entt::entity const entity) {
+                    signature_type::invoke(objects, storages, entity, process);
+                });
+            else
+                this->count_processed(signature_type::each(objects, storages, process));
 
             this->update();
         }
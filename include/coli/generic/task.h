@@ -0,0 +1,355 @@
+#ifndef COLI_GENERIC_TASK_H
+#define COLI_GENERIC_TASK_H
+
+#include "coli/utility.h"
+
+/**
+ * @brief For internal details.
+ * @note The user should not use this namespace.
+ */
+namespace Coli::Generic::Detail
+{
+    class COLI_EXPORT TaskFramePool final
+    {
+    public:
+        TaskFramePool() = delete;
+
+        [[nodiscard]] static void* allocate(std::size_t size);
+        static void deallocate(void* pointer, std::size_t size) noexcept;
+    };
+}
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    class TaskScheduler;
+
+    /**
+     * @brief Coroutine task.
+     * @details Return type of the coroutines executed by a TaskScheduler.
+     * A task may `co_await` the next frame, a count of frames, a delay in
+     * the simulated time or another task. A task does not start until it
+     * is started by the scheduler or awaited by another task. Frames of the
+     * coroutines are allocated from a pool, so suspended tasks do not
+     * allocate per frame.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT Task final
+    {
+    public:
+        class promise_type;
+
+        /// @brief Handle of the task coroutine.
+        using handle_type = std::coroutine_handle<promise_type>;
+
+    private:
+        class FinalAwaiter final
+        {
+        public:
+            [[nodiscard]] bool await_ready() const noexcept {
+                return false;
+            }
+
+            [[nodiscard]] std::coroutine_handle<> await_suspend(handle_type handle) noexcept;
+
+            void await_resume() const noexcept
+            {}
+        };
+
+        class TaskAwaiter final
+        {
+        public:
+            explicit TaskAwaiter(handle_type handle) noexcept :
+                myHandle (handle)
+            {}
+
+            [[nodiscard]] bool await_ready() const noexcept {
+                return !myHandle || myHandle.done();
+            }
+
+            [[nodiscard]] std::coroutine_handle<> await_suspend(handle_type awaiting) noexcept;
+
+            void await_resume() const;
+
+        private:
+            handle_type myHandle;
+        };
+
+        class FramesAwaiter final
+        {
+        public:
+            explicit FramesAwaiter(std::uint64_t count) noexcept :
+                myCount (count)
+            {}
+
+            [[nodiscard]] bool await_ready() const noexcept {
+                return myCount == 0;
+            }
+
+            void await_suspend(handle_type awaiting) const;
+
+            void await_resume() const noexcept
+            {}
+
+        private:
+            std::uint64_t myCount;
+        };
+
+        class DelayAwaiter final
+        {
+        public:
+            explicit DelayAwaiter(std::chrono::nanoseconds delay) noexcept :
+                myDelay (delay)
+            {}
+
+            [[nodiscard]] bool await_ready() const noexcept {
+                return myDelay <= std::chrono::nanoseconds::zero();
+            }
+
+            void await_suspend(handle_type awaiting) const;
+
+            void await_resume() const noexcept
+            {}
+
+        private:
+            std::chrono::nanoseconds myDelay;
+        };
+
+        explicit Task(handle_type handle) noexcept;
+
+        friend class TaskScheduler;
+
+    public:
+        /**
+         * @brief Promise of the task.
+         * @note The user should not use this class.
+         */
+        class COLI_EXPORT promise_type final
+        {
+        public:
+            [[nodiscard]] static void* operator new(std::size_t size) {
+                return Detail::TaskFramePool::allocate(size);
+            }
+
+            static void operator delete(void* pointer, std::size_t size) noexcept {
+                Detail::TaskFramePool::deallocate(pointer, size);
+            }
+
+            [[nodiscard]] Task get_return_object() noexcept {
+                return Task { handle_type::from_promise(*this) };
+            }
+
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept {
+                return {};
+            }
+
+            [[nodiscard]] FinalAwaiter final_suspend() const noexcept {
+                return {};
+            }
+
+            void return_void() const noexcept
+            {}
+
+            void unhandled_exception() noexcept {
+                myError = std::current_exception();
+            }
+
+        private:
+            friend class Task;
+            friend class TaskScheduler;
+
+            TaskScheduler* myScheduler = nullptr;
+            std::coroutine_handle<> myContinuation;
+            std::exception_ptr myError;
+            std::size_t myRoot = static_cast<std::size_t>(-1);
+        };
+
+        /**
+         * @brief Creates empty task.
+         * @details Creates a task without a coroutine.
+         */
+        Task() noexcept;
+
+        /**
+         * @brief Moves task.
+         * @details Just moves the coroutine. The other task becomes empty.
+         *
+         * @param other Other task.
+         */
+        Task(Task&& other) noexcept;
+        Task(Task const&) = delete;
+
+        /// @copydoc Task(Task&&)
+        Task& operator=(Task&& other) noexcept;
+        Task& operator=(Task const&) = delete;
+
+        /**
+         * @brief Destroys task.
+         * @details Destroys the coroutine if the task owns one.
+         */
+        ~Task() noexcept;
+
+        /**
+         * @brief Checks task is done.
+         * @details Checks the coroutine has finished.
+         *
+         * @return Checking result.
+         *
+         * @retval True If the coroutine has finished or the task is empty;
+         * @retval False Otherwise.
+         */
+        [[nodiscard]] bool done() const noexcept;
+
+        /**
+         * @brief Awaits task.
+         * @details Starts the task and suspends the awaiting one until
+         * the task has finished. Rethrows the exception of the task.
+         *
+         * @return Awaiter of the task.
+         */
+        [[nodiscard]] TaskAwaiter operator co_await() && noexcept;
+
+        /**
+         * @brief Awaits next frame.
+         * @details Suspends the awaiting task until the next frame.
+         *
+         * @return Awaiter of the frame.
+         */
+        [[nodiscard]] static FramesAwaiter next_frame() noexcept;
+
+        /**
+         * @brief Awaits frames.
+         * @details Suspends the awaiting task for the count of frames.
+         * Does not suspend if the count is zero.
+         *
+         * @param count Count of frames to wait.
+         *
+         * @return Awaiter of the frames.
+         */
+        [[nodiscard]] static FramesAwaiter frames(std::uint64_t count) noexcept;
+
+        /**
+         * @brief Awaits delay.
+         * @details Suspends the awaiting task until the simulated time
+         * of the scheduler has advanced by the delay. Does not suspend
+         * if the delay is not positive.
+         *
+         * @param delay Delay to wait.
+         *
+         * @return Awaiter of the delay.
+         */
+        [[nodiscard]] static DelayAwaiter delay(std::chrono::nanoseconds delay) noexcept;
+
+    private:
+        handle_type myHandle;
+    };
+
+    /**
+     * @brief Tasks scheduler.
+     * @details Owns the started tasks and resumes them once per frame,
+     * when the frames or the delay they wait for have passed. Tasks that
+     * are due at the same time are resumed in the order they suspended.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT TaskScheduler final
+    {
+        struct Waiter
+        {
+            std::int64_t due;
+            std::uint64_t order;
+            std::coroutine_handle<> handle;
+
+            [[nodiscard]] bool operator>(Waiter const& other) const noexcept;
+        };
+
+        [[noreturn]] static void fail_empty_task();
+
+        void push(std::vector<Waiter>& waiters, std::int64_t due, std::coroutine_handle<> handle);
+        void pop_due(std::vector<Waiter>& waiters, std::int64_t now);
+
+        void destroy_root(Task::handle_type handle) noexcept;
+
+        friend class Task;
+
+        void wait_frames(std::coroutine_handle<> handle, std::uint64_t count);
+        void wait_time(std::coroutine_handle<> handle, std::chrono::nanoseconds delay);
+        void finish(Task::handle_type handle) noexcept;
+
+    public:
+        /**
+         * @brief Creates tasks scheduler.
+         * @details Creates a scheduler without tasks.
+         */
+        TaskScheduler() noexcept;
+
+        /// @brief The tasks refer to their scheduler, so it cannot be moved.
+        TaskScheduler(TaskScheduler&&) = delete;
+        TaskScheduler(TaskScheduler const&) = delete;
+
+        TaskScheduler& operator=(TaskScheduler&&) = delete;
+        TaskScheduler& operator=(TaskScheduler const&) = delete;
+
+        /**
+         * @brief Destroys tasks scheduler.
+         * @details Destroys all the unfinished tasks.
+         */
+        ~TaskScheduler() noexcept;
+
+        /**
+         * @brief Starts task.
+         * @details Takes the ownership of the task and resumes it
+         * first on the next update.
+         *
+         * @param task Task to start.
+         *
+         * @throw std::invalid_argument If the task is empty or has already started;
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void start(Task task);
+
+        /**
+         * @brief Updates tasks.
+         * @details Advances the frame and the simulated time, then resumes
+         * the tasks that are due. The finished tasks are destroyed.
+         *
+         * @param delta Simulated time of the frame.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw Any The first exception thrown by a task.
+         */
+        void update(std::chrono::nanoseconds delta);
+
+        /**
+         * @brief Returns tasks count.
+         * @details Returns the count of the started unfinished tasks.
+         *
+         * @return Count of the tasks.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * @brief Returns simulated time.
+         * @details Returns the sum of the delta times of all the updates.
+         *
+         * @return Simulated time.
+         */
+        [[nodiscard]] std::chrono::nanoseconds time() const noexcept;
+
+    private:
+        std::vector<Task::handle_type> myRoots;
+        std::vector<Task::handle_type> myFinished;
+        std::vector<Waiter> myFrameWaiters;
+        std::vector<Waiter> myTimeWaiters;
+        std::vector<std::coroutine_handle<>> myReady;
+
+        std::int64_t myFrame;
+        std::int64_t myTime;
+        std::uint64_t myOrder;
+    };
+}
+
+#endif
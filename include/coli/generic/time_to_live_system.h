@@ -0,0 +1,125 @@
+#ifndef COLI_GENERIC_TIME_TO_LIVE_SYSTEM_H
+#define COLI_GENERIC_TIME_TO_LIVE_SYSTEM_H
+
+#include "coli/generic/system.h"
+#include "coli/generic/timer_wheel.h"
+#include "coli/game/observer.h"
+#include "coli/game/components/time_to_live.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Time to live system.
+     * @details Destroys the objects whose @ref Game::Components::TimeToLive
+     * has expired. The countdowns are kept in a timer wheel, so a frame
+     * touches only the objects with new or patched components and the
+     * objects whose time is over, instead of every object. The expired
+     * objects are destroyed in bulk through the command buffers after
+     * the systems of the frame.
+     *
+     * The time is converted to the ticks of a fixed duration, and the wheel
+     * is advanced by all the ticks of the simulated time an execution covers,
+     * so the lifetimes do not depend on the frame rate, the hitches or the
+     * run policy of the system. The frames without simulated time, e.g. the
+     * redraws of the on-demand loop, do not advance it.
+     *
+     * The system keeps its own wheel instead of the frame timers, since
+     * those keep a single timer per object, which the time to live would
+     * replace for the objects that have timers of the user.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT TimeToLiveSystem final :
+        public Detail::SystemBase
+    {
+        using component_type = Game::Components::TimeToLive;
+        using observer_type = Game::Observer<component_type>;
+
+        [[noreturn]] static void fail_invalid_tick();
+
+    public:
+        /**
+         * @detail Creates time to live system.
+         * @details Creates the system without countdowns, ticking
+         * by the default step of a shard.
+         */
+        TimeToLiveSystem() noexcept;
+
+        /**
+         * @detail Creates time to live system.
+         * @details Creates the system without countdowns, ticking
+         * by the specific duration.
+         *
+         * @param tick Duration of a tick of the wheel.
+         *
+         * @throw std::invalid_argument If the tick is not positive.
+         */
+        explicit TimeToLiveSystem(std::chrono::nanoseconds tick);
+
+        /**
+         * @detail Copies time to live system.
+         * @details Copies the system without its countdowns, so the copy
+         * restarts the countdowns of all the objects on the first execution.
+         */
+        TimeToLiveSystem(TimeToLiveSystem const&) noexcept;
+
+        /**
+         * @detail Moves time to live system.
+         * @details Has the default implementation.
+         */
+        TimeToLiveSystem(TimeToLiveSystem&&) noexcept;
+
+        /// @copydoc TimeToLiveSystem(TimeToLiveSystem const&)
+        TimeToLiveSystem& operator=(TimeToLiveSystem const&) noexcept;
+
+        /// @copydoc TimeToLiveSystem(TimeToLiveSystem&&)
+        TimeToLiveSystem& operator=(TimeToLiveSystem&&) noexcept;
+
+        /**
+         * @detail Destroys time to live system.
+         * @details Has the default implementation.
+         */
+        ~TimeToLiveSystem() noexcept override;
+
+        /**
+         * @brief Returns timer wheel.
+         * @details Returns the countdowns of the objects,
+         * measured in ticks.
+         *
+         * @return Reference to the wheel.
+         */
+        [[nodiscard]] TimerWheel const& wheel() const noexcept;
+
+        /**
+         * @brief Returns components access.
+         * @details Declares the time to live component as read.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         *
+         * @return Access of the system.
+         */
+        [[nodiscard]] SystemAccess access() const override;
+
+        /**
+         * @brief Prepares the system.
+         * @note The user should not use this method.
+         */
+        void prepare(Game::Scene& scene, Frame const& frame) override;
+
+        /**
+         * @brief Executes the system.
+         * @note The user should not use this method.
+         */
+        void execute(Game::Scene& scene, Frame const& frame) override;
+
+    private:
+        std::unique_ptr<observer_type> myObserver;
+        TimerWheel myWheel;
+        Types::float_type myTick;
+        Types::float_type myTicks;
+    };
+}
+
+#endif
@@ -0,0 +1,344 @@
+#ifndef COLI_GENERIC_TIMER_WHEEL_H
+#define COLI_GENERIC_TIMER_WHEEL_H
+
+#include "coli/utility.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Hierarchical timing wheel.
+     * @details Keeps a countdown per object, measured in ticks. The timers
+     * are hashed into the buckets of several levels by their deadlines, so
+     * scheduling and cancelling are O(1), and a tick touches only the bucket
+     * that is due, instead of every timer. The buckets of the upper levels
+     * are cascaded to the lower ones when their time comes. The timers
+     * fired by a tick are collected into a batch.
+     *
+     * An object has at most one timer in a wheel. Use separate wheels for
+     * the countdowns of different kinds, e.g. cooldowns and buffs.
+     *
+     * @note Not thread-safe. Concurrent access requires
+     * external synchronization.
+     */
+    class COLI_EXPORT TimerWheel final
+    {
+        struct Node {
+            entt::entity entity = entt::null;
+            std::uint32_t bucket = std::numeric_limits<std::uint32_t>::max();
+            std::uint32_t previous = 0;
+            std::uint32_t next = 0;
+            std::uint64_t deadline = 0;
+        };
+
+        void insert(std::uint32_t index) noexcept;
+        void unlink(std::uint32_t index) noexcept;
+        void cascade(std::size_t level) noexcept;
+
+    public:
+        /// @brief Count of the bits of the tick per level.
+        static constexpr std::size_t level_bits = 6;
+
+        /// @brief Count of the buckets per level.
+        static constexpr std::size_t level_size = std::size_t { 1 } << level_bits;
+
+        /// @brief Count of the levels.
+        static constexpr std::size_t levels = 4;
+
+        /**
+         * @brief Creates timer wheel.
+         * @details Creates a wheel without timers at the zero tick.
+         */
+        TimerWheel() noexcept;
+
+        /**
+         * @brief Copies timer wheel.
+         * @details Copies the timers and the fired batch.
+         *
+         * @param other Other timer wheel.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        TimerWheel(TimerWheel const& other);
+
+        /**
+         * @brief Moves timer wheel.
+         * @details Just moves the timers.
+         *
+         * @param other Other timer wheel.
+         */
+        TimerWheel(TimerWheel&& other) noexcept;
+
+        /// @copydoc TimerWheel(TimerWheel const&)
+        TimerWheel& operator=(TimerWheel const& other);
+
+        /// @copydoc TimerWheel(TimerWheel&&)
+        TimerWheel& operator=(TimerWheel&& other) noexcept;
+
+        /// @brief Destroys timer wheel.
+        ~TimerWheel() noexcept;
+
+        /**
+         * @brief Schedules timer.
+         * @details Schedules the timer of the object to fire after the
+         * specific count of ticks. Replaces the timer the object already
+         * has. Zero ticks fire on the next tick, like one.
+         *
+         * @param entity Object of the timer;
+         * @param ticks Count of ticks to wait.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void schedule(entt::entity entity, std::uint64_t ticks);
+
+        /**
+         * @brief Cancels timer.
+         * @details Cancels the timer of the object if it has one.
+         *
+         * @param entity Object of the timer.
+         *
+         * @return Whether the timer was cancelled.
+         *
+         * @retval True If the object had a timer;
+         * @retval False If the object had no timers.
+         */
+        bool cancel(entt::entity entity) noexcept;
+
+        /**
+         * @brief Checks timer.
+         * @details Checks if the object has a scheduled timer.
+         *
+         * @param entity Object to check.
+         *
+         * @return Whether the object has a timer.
+         */
+        [[nodiscard]] bool scheduled(entt::entity entity) const noexcept;
+
+        /**
+         * @brief Returns remaining ticks.
+         * @details Returns the count of ticks after which the timer
+         * of the object fires.
+         *
+         * @param entity Object of the timer.
+         *
+         * @return Count of the remaining ticks, or zero if
+         * the object has no timer.
+         */
+        [[nodiscard]] std::uint64_t remaining(entt::entity entity) const noexcept;
+
+        /**
+         * @brief Advances wheel.
+         * @details Advances the wheel by one tick and replaces the fired
+         * batch with the objects whose timers are due. The fired timers
+         * are removed from the wheel.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void advance();
+
+        /**
+         * @brief Returns fired batch.
+         * @details Returns the objects whose timers fired on the last
+         * tick, in no particular order. The span is valid until the next
+         * tick or modification of the wheel.
+         *
+         * @return Span of the objects.
+         */
+        [[nodiscard]] std::span<entt::entity const> fired() const noexcept;
+
+        /**
+         * @brief Returns current tick.
+         * @details Returns the count of ticks since the creation
+         * of the wheel.
+         *
+         * @return Current tick.
+         */
+        [[nodiscard]] std::uint64_t now() const noexcept;
+
+        /**
+         * @brief Returns timers count.
+         * @details Returns the count of the scheduled timers.
+         *
+         * @return Count of the timers.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * @brief Checks timers.
+         * @details Checks if there are no scheduled timers.
+         *
+         * @return Whether the wheel is empty.
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Clears wheel.
+         * @details Cancels all the timers and drops the fired batch.
+         * Keeps the current tick.
+         */
+        void clear() noexcept;
+
+    private:
+        std::vector<Node> myNodes;
+        std::vector<entt::entity> myFired;
+        std::array<std::uint32_t, levels * level_size> myBuckets;
+
+        std::uint64_t myNow;
+        std::size_t mySize;
+    };
+
+    /**
+     * @brief Frame timers.
+     * @details The timer wheel of the engine, advanced by one tick at the
+     * beginning of every frame that simulates time, before the systems are
+     * executed. The frames without simulated time, e.g. the redraws of the
+     * on-demand loop, neither advance it nor fire the timers. The
+     * systems read the objects whose timers fired in this frame as one
+     * batch via @ref fired(), instead of decrementing a countdown of every
+     * object in every frame.
+     *
+     * The systems schedule and cancel the timers from any worker without
+     * locks: the requests are recorded per worker pool slot and applied
+     * in the order of the slots after the systems of the frame, so
+     * a timer of N ticks fires in the N-th simulated frame after this one.
+     *
+     * @note Each thread must only record to its own slot. Other access
+     * requires external synchronization.
+     */
+    class COLI_EXPORT FrameTimers final
+    {
+        struct Request {
+            entt::entity entity;
+            std::uint64_t ticks;
+        };
+
+        struct alignas(Utility::cache_line_size) Slot {
+            std::vector<Request> requests;
+        };
+
+        /// @brief Count of ticks that marks a cancel request.
+        static constexpr std::uint64_t cancel_ticks = std::numeric_limits<std::uint64_t>::max();
+
+    public:
+        /**
+         * @brief Creates frame timers.
+         * @details Creates the request buffers for the specific
+         * count of slots.
+         *
+         * @param slots Count of the worker pool slots.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        explicit FrameTimers(std::size_t slots = 1);
+
+        /**
+         * @brief Moves frame timers.
+         * @details Just moves the wheel and the buffers.
+         *
+         * @param other Other frame timers.
+         */
+        FrameTimers(FrameTimers&& other) noexcept;
+        FrameTimers(FrameTimers const&) = delete;
+
+        /// @copydoc FrameTimers(FrameTimers&&)
+        FrameTimers& operator=(FrameTimers&& other) noexcept;
+        FrameTimers& operator=(FrameTimers const&) = delete;
+
+        /// @brief Destroys frame timers.
+        ~FrameTimers() noexcept;
+
+        /**
+         * @brief Schedules timer.
+         * @details Records the request to schedule the timer of the object
+         * to the slot of the calling thread. Replaces the timer the object
+         * already has when applied.
+         *
+         * @param entity Object of the timer;
+         * @param ticks Count of frames to wait.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw std::out_of_range If the calling thread slot is out of
+         * the slots range.
+         */
+        void schedule(entt::entity entity, std::uint64_t ticks);
+
+        /**
+         * @brief Cancels timer.
+         * @details Records the request to cancel the timer of the object
+         * to the slot of the calling thread.
+         *
+         * @param entity Object of the timer.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw std::out_of_range If the calling thread slot is out of
+         * the slots range.
+         */
+        void cancel(entt::entity entity);
+
+        /**
+         * @brief Returns fired batch.
+         * @details Returns the objects whose timers fired in this frame,
+         * or nothing if the frame has not advanced the wheel. The objects
+         * may have been destroyed since they were scheduled.
+         *
+         * @return Span of the objects.
+         */
+        [[nodiscard]] std::span<entt::entity const> fired() const noexcept;
+
+        /**
+         * @brief Returns timer wheel.
+         * @details Returns the wheel with the applied requests.
+         *
+         * @return Reference to the wheel.
+         */
+        [[nodiscard]] TimerWheel& wheel() noexcept;
+
+        /// @copydoc wheel()
+        [[nodiscard]] TimerWheel const& wheel() const noexcept;
+
+        /**
+         * @brief Returns slots count.
+         * @details Returns the count of the request buffers.
+         *
+         * @return Count of the slots.
+         */
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /**
+         * @brief Resizes buffers.
+         * @details Recreates the request buffers for the specific count
+         * of slots. Keeps the scheduled timers and drops the requests
+         * that are not applied yet.
+         *
+         * @param slots Count of the worker pool slots.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void resize(std::size_t slots);
+
+        /**
+         * @brief Advances timers.
+         * @details Advances the wheel by one tick.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void advance();
+
+        /**
+         * @brief Flushes requests.
+         * @details Applies the requests of all the slots to the wheel
+         * and clears the buffers.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void flush();
+
+    private:
+        TimerWheel myWheel;
+        std::unique_ptr<Slot[]> mySlots;
+        std::size_t mySize;
+        bool myIsAdvanced;
+    };
+}
+
+#endif
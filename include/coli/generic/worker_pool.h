@@ -0,0 +1,290 @@
+#ifndef COLI_GENERIC_WORKER_POOL_H
+#define COLI_GENERIC_WORKER_POOL_H
+
+#include "coli/utility.h"
+
+/// @brief Namespace for the all generic for game engines stuff.
+namespace Coli::Generic
+{
+    /**
+     * @brief Counter of jobs.
+     * @details Counts the unfinished jobs submitted with it, including
+     * their children. Wait on it with WorkerPool::wait().
+     *
+     * @note Thread-safe.
+     */
+    class COLI_EXPORT JobCounter final
+    {
+        friend class WorkerPool;
+
+    public:
+        /**
+         * @brief Creates job counter.
+         * @details Creates a counter without jobs.
+         */
+        JobCounter() noexcept;
+
+        JobCounter(JobCounter&&) = delete;
+        JobCounter(JobCounter const&) = delete;
+
+        JobCounter& operator=(JobCounter&&) = delete;
+        JobCounter& operator=(JobCounter const&) = delete;
+
+        /**
+         * @brief Destroys job counter.
+         * @details Has the default implementation. No counted
+         * jobs must remain.
+         */
+        ~JobCounter() noexcept;
+
+        /**
+         * @brief Returns jobs count.
+         * @details Returns the count of the unfinished counted jobs.
+         *
+         * @return Count of the jobs.
+         */
+        [[nodiscard]] std::size_t value() const noexcept;
+
+        /**
+         * @brief Checks jobs are done.
+         * @details Checks all the counted jobs have finished.
+         *
+         * @return Checking result.
+         *
+         * @retval True If there are no unfinished jobs;
+         * @retval False Otherwise.
+         */
+        [[nodiscard]] bool done() const noexcept;
+
+    private:
+        std::atomic<std::size_t> myValue;
+    };
+
+    /**
+     * @brief Pool of worker threads.
+     * @details Executes submitted jobs on a fixed set of worker threads.
+     * Every worker has its own queue and steals jobs from the others
+     * when it runs out of work. A thread waiting for the jobs helps the
+     * workers to execute them, so a pool without workers still makes
+     * progress.
+     *
+     * A job submitted with a counter is a parent job: the jobs it
+     * submits as children are counted by the same counter, so waiting
+     * on the counter waits for the whole tree of the jobs.
+     *
+     * @note Thread-safe.
+     */
+    class COLI_EXPORT WorkerPool final
+    {
+        [[noreturn]] static void fail_slot_out_of_range();
+
+        struct Job
+        {
+            std::function<void()> function;
+            JobCounter* counter = nullptr;
+        };
+
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        using chunk_function = void(*)(void* context, std::size_t first, std::size_t last);
+
+        template <class Func>
+        static void invoke_chunk(void* context, std::size_t first, std::size_t last) {
+            (*static_cast<Func*>(context))(first, last);
+        }
+
+        void dispatch(
+            std::size_t first,
+            std::size_t last,
+            std::size_t grain,
+            chunk_function function,
+            void* context);
+
+        [[nodiscard]] bool take(std::size_t slot, Job& job);
+
+        void push(Job job);
+        static void execute(Job& job) noexcept;
+
+    public:
+        /// @brief Type of the job executed by the pool.
+        using job_type = std::function<void()>;
+
+        /**
+         * @brief Creates worker pool.
+         * @details Creates a pool and starts the specific count of
+         * the worker threads.
+         *
+         * @param workers Count of the worker threads. Pass 0 to execute
+         * all jobs on the waiting thread;
+         * @param pin Pins the workers to the CPUs, one per CPU skipping the
+         * first one, if the platform supports it.
+         *
+         * @throw std::bad_alloc If allocation fails;
+         * @throw std::system_error If a thread cannot be started.
+         */
+        explicit WorkerPool(std::size_t workers, bool pin = false);
+
+        WorkerPool(WorkerPool&&) = delete;
+        WorkerPool(WorkerPool const&) = delete;
+
+        WorkerPool& operator=(WorkerPool&&) = delete;
+        WorkerPool& operator=(WorkerPool const&) = delete;
+
+        /**
+         * @brief Destroys worker pool.
+         * @details Executes the remaining jobs, then stops and
+         * joins all the worker threads.
+         */
+        ~WorkerPool() noexcept;
+
+        /**
+         * @brief Returns workers count.
+         * @details Returns the count of the worker threads.
+         *
+         * @return Count of the worker threads.
+         */
+        [[nodiscard]] std::size_t worker_count() const noexcept;
+
+        /**
+         * @brief Returns slots count.
+         * @details Returns the count of the threads that can execute
+         * the jobs: all the workers and one slot shared by the other
+         * threads.
+         *
+         * @return Count of the slots.
+         */
+        [[nodiscard]] std::size_t slot_count() const noexcept;
+
+        /**
+         * @brief Returns current slot.
+         * @details Returns the slot of the calling thread. Workers have
+         * slots from 1 to the workers count, any other thread has the 0 slot.
+         *
+         * @return Slot of the calling thread.
+         */
+        [[nodiscard]] static std::size_t current_slot() noexcept;
+
+        /**
+         * @brief Returns current slot checked.
+         * @details Returns the slot of the calling thread for a set of
+         * the per slot items, e.g. created for the slot count of a pool.
+         *
+         * @param count Count of the slots.
+         *
+         * @throw std::out_of_range If the slot is not less than the count,
+         * i.e. the thread belongs to a pool with more slots.
+         *
+         * @return Slot of the calling thread.
+         */
+        [[nodiscard]] static std::size_t current_slot(std::size_t count);
+
+        /**
+         * @brief Submits job.
+         * @details Queues the job to execute on any worker or
+         * a waiting thread. Jobs submitted from a worker are queued
+         * to the worker's own queue.
+         *
+         * @param job Job to execute. It must not throw.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void submit(job_type job);
+
+        /**
+         * @brief Submits counted job.
+         * @details Queues the job like @ref submit(job_type) and counts it
+         * by the counter until the job and all its children have finished.
+         *
+         * @param job Job to execute. It must not throw;
+         * @param counter Counter of the job. It must outlive the job.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void submit(job_type job, JobCounter& counter);
+
+        /**
+         * @brief Submits child job.
+         * @details Queues the job as a child of the executing counted job,
+         * so the counter of the parent counts it too. Called outside of
+         * a counted job, works like @ref submit(job_type).
+         *
+         * @param job Job to execute. It must not throw.
+         *
+         * @throw std::bad_alloc If allocation fails.
+         */
+        void submit_child(job_type job);
+
+        /**
+         * @brief Runs a pending job.
+         * @details Takes one queued job, stealing it from the other
+         * queues if necessary, and executes it on the calling thread.
+         *
+         * @return Execution result.
+         *
+         * @retval True If a job was executed;
+         * @retval False If there were no queued jobs.
+         */
+        bool run_pending();
+
+        /**
+         * @brief Waits for counter.
+         * @details Blocks until the counter becomes zero. Executes
+         * the queued jobs while waiting.
+         *
+         * @param counter Counter decremented by the awaited jobs.
+         */
+        void wait(std::atomic<std::size_t> const& counter);
+
+        /// @copydoc wait(std::atomic<std::size_t> const&)
+        void wait(JobCounter const& counter);
+
+        /**
+         * @brief Executes function over range in parallel.
+         * @details Splits the range into chunks of the grain size and
+         * executes the function for them on the workers and the calling
+         * thread. Returns when all the chunks have finished.
+         *
+         * @tparam Func Type of the function. It is called with the first
+         * and the last index of a chunk.
+         *
+         * @param first First index of the range;
+         * @param last Index past the last one of the range;
+         * @param grain Maximal count of indices in a chunk;
+         * @param func Function to execute.
+         *
+         * @throw Any The first exception thrown by the function.
+         */
+        template <class Func>
+            requires (std::invocable<Func&, std::size_t, std::size_t>)
+        void parallel_for(std::size_t first, std::size_t last, std::size_t grain, Func&& func)
+        {
+            using type = std::remove_reference_t<Func>;
+
+            dispatch(first, last, grain, &invoke_chunk<type>,
+                const_cast<void*>(static_cast<void const*>(std::addressof(func))));
+        }
+
+    private:
+        void work(std::size_t slot) noexcept;
+        void shutdown() noexcept;
+        void pin(std::size_t slot) noexcept;
+
+        std::unique_ptr<Queue[]> myQueues;
+        std::size_t mySlotCount;
+
+        std::atomic<std::size_t> myQueued;
+        std::atomic<std::size_t> mySleeping;
+        std::atomic<bool> myIsStopping;
+
+        std::mutex mySleepMutex;
+        std::condition_variable myWakeup;
+
+        std::vector<std::thread> myThreads;
+    };
+}
+
+#endif
@@ -24,6 +24,21 @@
 #include <thread>
 #include <mutex>
 #include <bit>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <exception>
+#include <span>
+#include <chrono>
+#include <coroutine>
+#include <array>
+#include <optional>
+#include <memory_resource>
+#include <ranges>
+#include <limits>
+#include <cmath>
+#include <initializer_list>
 
 #define GLM_ENABLE_EXPERIMENTAL
 
@@ -72,6 +87,9 @@ namespace Coli::inline Types
 /// @brief Namespace for the library utilities stuff.
 namespace Coli::Utility
 {
+    /// @brief Assumed size of a CPU cache line in bytes.
+    inline constexpr std::size_t cache_line_size = 64;
+
     /**
      * @brief Hash mixer.
      * @details Functor for mixing hashes.
@@ -0,0 +1,120 @@
+#include "coli/game/command_buffer.h"
+
+namespace Coli::Game
+{
+    void CommandBuffer::fail_unbound() {
+        throw std::logic_error("The command buffer is not bound to a scene");
+    }
+
+    CommandBuffer::CommandBuffer() noexcept :
+        myScene   (nullptr),
+        myIsEmpty (true)
+    {}
+
+    CommandBuffer::CommandBuffer(Scene& scene) noexcept :
+        myScene   (std::addressof(scene)),
+        myIsEmpty (true)
+    {}
+
+    CommandBuffer::CommandBuffer(CommandBuffer&& other) noexcept :
+        myScene      (std::exchange(other.myScene, nullptr)),
+        myDestroyed  (std::move(other.myDestroyed)),
+        myComponents (std::move(other.myComponents)),
+        myIsEmpty    (std::exchange(other.myIsEmpty, true))
+    {}
+
+    CommandBuffer& CommandBuffer::operator=(CommandBuffer&& other) noexcept
+    {
+        myScene = std::exchange(other.myScene, nullptr);
+        myDestroyed = std::move(other.myDestroyed);
+        myComponents = std::move(other.myComponents);
+        myIsEmpty = std::exchange(other.myIsEmpty, true);
+
+        return *this;
+    }
+
+    CommandBuffer::~CommandBuffer() noexcept = default;
+
+    void CommandBuffer::bind(Scene& scene) noexcept {
+        myScene = std::addressof(scene);
+    }
+
+    entt::entity CommandBuffer::create()
+    {
+        if (!myScene)
+            fail_unbound();
+
+        return myScene->reserve();
+    }
+
+    void CommandBuffer::destroy(entt::entity const entity)
+    {
+        myDestroyed.push_back(entity);
+        myIsEmpty = false;
+    }
+
+    void CommandBuffer::destroy(ObjectHandle const& handle)
+    {
+        if (!handle.expired())
+            destroy(handle.myHandle);
+    }
+
+    bool CommandBuffer::empty() const noexcept {
+        return myIsEmpty;
+    }
+
+    void CommandBuffer::clear() noexcept
+    {
+        myDestroyed.clear();
+
+        for (auto& [id, commands] : myComponents)
+            commands->clear();
+
+        myIsEmpty = true;
+    }
+
+    void CommandBuffer::flush()
+    {
+        if (!myScene)
+            fail_unbound();
+
+        CommandBuffer* const self = this;
+        flush(*myScene, std::span { &self, 1 });
+    }
+
+    void CommandBuffer::flush(Scene& scene, std::span<CommandBuffer* const> const buffers)
+    {
+        struct Guard
+        {
+            ~Guard() noexcept {
+                for (auto* const buffer : flushed)
+                    buffer->clear();
+            }
+
+            std::span<CommandBuffer* const> flushed;
+        }
+        const guard { buffers };
+
+        scene.create_reserved();
+
+        if (std::ranges::all_of(buffers, &CommandBuffer::empty))
+            return;
+
+        auto& registry = *scene.myRegistry;
+        std::vector<std::pair<entt::id_type, Detail::ComponentCommandsBase*>> commands;
+
+        for (auto* const buffer : buffers)
+            for (auto& [id, recorded] : buffer->myComponents)
+                commands.emplace_back(id, recorded.get());
+
+        std::ranges::stable_sort(commands, {}, &decltype(commands)::value_type::first);
+
+        for (auto* const recorded : commands | std::views::values)
+            recorded->apply(registry);
+
+        for (auto* const buffer : buffers)
+            for (auto const entity : buffer->myDestroyed)
+                if (registry.valid(entity))
+                    registry.destroy(entity);
+    }
+}
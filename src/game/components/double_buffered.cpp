@@ -0,0 +1,27 @@
+#include "coli/game/components/double_buffered.h"
+
+namespace Coli::Game::Detail
+{
+    /* BufferState */
+
+    BufferState::BufferState() noexcept :
+        myIsWritten (false),
+        myFront     (0)
+    {}
+
+    BufferState::~BufferState() noexcept = default;
+
+    std::size_t BufferState::front() const noexcept {
+        return myFront;
+    }
+
+    void BufferState::written() noexcept {
+        myIsWritten.store(true, std::memory_order_relaxed);
+    }
+
+    void BufferState::swap() noexcept
+    {
+        if (myIsWritten.exchange(false, std::memory_order_relaxed))
+            myFront ^= 1;
+    }
+}
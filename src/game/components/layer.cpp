@@ -1,16 +1,80 @@
 #include "coli/game/components/layer.h"
 
-namespace Coli::Game::Components
+namespace Coli::Game::Detail
 {
-    /* Layer */
+    namespace
+    {
+        struct StableSort
+        {
+            template <class It, class Compare>
+            void operator()(It const first, It const last, Compare compare) const {
+                std::stable_sort(first, last, std::move(compare));
+            }
+        };
+    }
+
+    /* LayerOrder */
+
+    LayerOrder::LayerOrder() noexcept :
+        myTouched (0),
+        myIsDirty (true)
+    {}
 
-    Layer::Layer(const Layer&) noexcept = default;
-    Layer::Layer(Layer&&) noexcept = default;
+    LayerOrder::~LayerOrder() noexcept = default;
 
-    Layer& Layer::operator=(const Layer&) noexcept = default;
-    Layer& Layer::operator=(Layer&&) noexcept = default;
+    bool LayerOrder::sorts(entt::id_type const id) const noexcept
+    {
+        return id == entt::type_hash<Components::Layer>::value()
+            || std::ranges::find(myDependents, id, &decltype(myDependents)::value_type::first) != myDependents.end();
+    }
+
+    void LayerOrder::depend(entt::id_type const id, sorter_type const sorter)
+    {
+        if (!sorts(id)) {
+            myDependents.emplace_back(id, sorter);
+            myIsDirty.store(true, std::memory_order_relaxed);
+        }
+    }
 
-    Layer::~Layer() noexcept = default;
+    void LayerOrder::touch(entt::registry&, entt::entity) noexcept {
+        myTouched.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void LayerOrder::written() noexcept {
+        myIsDirty.store(true, std::memory_order_relaxed);
+    }
+
+    bool LayerOrder::update(entt::registry& registry)
+    {
+        auto const touched = myTouched.exchange(0, std::memory_order_acquire);
+
+        if (touched == 0 && !myIsDirty.load(std::memory_order_acquire))
+            return false;
+
+        auto const less = [] (Components::Layer const& first, Components::Layer const& second) {
+            return first.layer() < second.layer();
+        };
+
+        // Every touched object may be moved across the whole storage by the
+        // insertion sort, so it is close to linear only when few objects moved.
+        // A bulk spawn is sorted from scratch instead, as stable as the
+        // insertion sort, so the equal layers are not reordered.
+        if (touched > std::bit_width(registry.storage<Components::Layer>().size()))
+            registry.sort<Components::Layer>(less, StableSort {});
+        else
+            registry.sort<Components::Layer>(less, entt::insertion_sort {});
+
+        for (auto const& [id, sorter] : myDependents)
+            sorter(registry);
+
+        myIsDirty.store(false, std::memory_order_relaxed);
+        return true;
+    }
+}
+
+namespace Coli::Game::Components
+{
+    /* Layer */
 
     Layer::Layer() noexcept:
         myValue (0)
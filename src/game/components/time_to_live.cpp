@@ -0,0 +1,26 @@
+#include "coli/game/components/time_to_live.h"
+
+namespace Coli::Game::Components
+{
+    /* TimeToLive */
+
+    TimeToLive::TimeToLive(Types::float_type const seconds) noexcept :
+        mySeconds (seconds)
+    {}
+
+    TimeToLive::TimeToLive(TimeToLive const&) noexcept = default;
+    TimeToLive::TimeToLive(TimeToLive&&) noexcept = default;
+
+    TimeToLive& TimeToLive::operator=(TimeToLive const&) noexcept = default;
+    TimeToLive& TimeToLive::operator=(TimeToLive&&) noexcept = default;
+
+    TimeToLive::~TimeToLive() noexcept = default;
+
+    Types::float_type TimeToLive::seconds() const noexcept {
+        return mySeconds;
+    }
+
+    void TimeToLive::seconds(Types::float_type const seconds) noexcept {
+        mySeconds = seconds;
+    }
+}
@@ -17,18 +17,6 @@ namespace Coli::Game::Components
         *this = BasicTransform {};
     }
 
-    template <bool Is2D>
-    BasicTransform<Is2D>::BasicTransform(const BasicTransform&) noexcept = default;
-
-    template <bool Is2D>
-    BasicTransform<Is2D>::BasicTransform(BasicTransform&&) noexcept = default;
-
-    template <bool Is2D>
-    BasicTransform<Is2D>& BasicTransform<Is2D>::operator=(const BasicTransform&) noexcept = default;
-
-    template <bool Is2D>
-    BasicTransform<Is2D>& BasicTransform<Is2D>::operator=(BasicTransform&&) noexcept = default;
-
     template <bool Is2D>
     bool BasicTransform<Is2D>::operator==(const BasicTransform& other) const noexcept = default;
 
@@ -36,4 +36,8 @@ namespace Coli::Game
 
         return true;
     }
+
+    entt::entity ObjectHandle::entity() const noexcept {
+        return myHandle;
+    }
 }
\ No newline at end of file
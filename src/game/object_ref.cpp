@@ -0,0 +1,162 @@
+#include "coli/game/object_ref.h"
+
+namespace Coli::Game::Detail
+{
+    namespace
+    {
+        struct SceneSlots
+        {
+            std::mutex mutex;
+            std::vector<std::uint32_t> free;
+            std::array<std::uint32_t, SceneTable::max_scenes> versions {};
+            std::uint32_t used = 0;
+        };
+
+        [[nodiscard]] SceneSlots& scene_slots() noexcept
+        {
+            static SceneSlots slots;
+            return slots;
+        }
+    }
+
+    /* SceneTable */
+
+    void SceneTable::fail_too_many_scenes() {
+        throw std::length_error("Too many scenes exist at once");
+    }
+
+    std::array<SceneTable::Entry, SceneTable::max_scenes>& SceneTable::entries() noexcept
+    {
+        static std::array<Entry, max_scenes> entries;
+        return entries;
+    }
+
+    std::uint32_t SceneTable::acquire(entt::registry& registry)
+    {
+        auto& slots = scene_slots();
+        std::lock_guard const lock { slots.mutex };
+
+        std::uint32_t slot;
+
+        if (!slots.free.empty()) {
+            slot = slots.free.back();
+            slots.free.pop_back();
+        }
+        else if (slots.used < max_scenes)
+            slot = slots.used++;
+        else
+            fail_too_many_scenes();
+
+        auto const id = (slots.versions[slot] << slot_bits) | slot;
+        auto& entry = entries()[slot];
+
+        entry.registry.store(std::addressof(registry), std::memory_order_relaxed);
+        entry.id.store(id, std::memory_order_release);
+
+        return id;
+    }
+
+    void SceneTable::release(std::uint32_t const id) noexcept
+    {
+        if (id == null)
+            return;
+
+        auto& slots = scene_slots();
+        std::lock_guard const lock { slots.mutex };
+
+        auto const slot = id & (max_scenes - 1);
+        auto& entry = entries()[slot];
+
+        entry.id.store(null, std::memory_order_release);
+        entry.registry.store(nullptr, std::memory_order_relaxed);
+
+        // The last version is skipped, so an identifier is never null.
+        auto& version = slots.versions[slot];
+        version = (version + 1) % (null >> slot_bits);
+
+        try {
+            slots.free.push_back(slot);
+        }
+        catch (...) {
+            // The slot is leaked, but the other ones are still usable.
+        }
+    }
+
+    entt::registry* SceneTable::resolve(std::uint32_t const id) noexcept
+    {
+        if (id == null) [[unlikely]]
+            return nullptr;
+
+        auto const& entry = entries()[id & (max_scenes - 1)];
+
+        if (entry.id.load(std::memory_order_acquire) != id)
+            return nullptr;
+
+        return entry.registry.load(std::memory_order_relaxed);
+    }
+
+    /* SceneSlot */
+
+    SceneSlot::SceneSlot() noexcept :
+        myId (SceneTable::null)
+    {}
+
+    SceneSlot::SceneSlot(entt::registry& registry) :
+        myId (SceneTable::acquire(registry))
+    {}
+
+    SceneSlot::SceneSlot(SceneSlot&& other) noexcept :
+        myId (std::exchange(other.myId, SceneTable::null))
+    {}
+
+    SceneSlot& SceneSlot::operator=(SceneSlot&& other) noexcept
+    {
+        if (this != std::addressof(other))
+            SceneTable::release(std::exchange(myId, std::exchange(other.myId, SceneTable::null)));
+
+        return *this;
+    }
+
+    SceneSlot::~SceneSlot() noexcept {
+        SceneTable::release(myId);
+    }
+
+    std::uint32_t SceneSlot::id() const noexcept {
+        return myId;
+    }
+}
+
+namespace Coli::Game
+{
+    /* ObjectRef */
+
+    void ObjectRef::fail_on_expired() {
+        throw std::bad_weak_ptr();
+    }
+
+    void ObjectRef::fail_not_exists() {
+        throw std::invalid_argument("Object doesn't contain a component of this type");
+    }
+
+    ObjectRef::ObjectRef() noexcept :
+        myScene  (Detail::SceneTable::null),
+        myEntity (entt::null)
+    {}
+
+    ObjectRef::ObjectRef(std::uint32_t const scene, entt::entity const entity) noexcept :
+        myScene  (scene),
+        myEntity (entity)
+    {}
+
+    bool ObjectRef::expired() const noexcept {
+        return resolve() == nullptr;
+    }
+
+    std::uint32_t ObjectRef::scene() const noexcept {
+        return myScene;
+    }
+
+    entt::entity ObjectRef::entity() const noexcept {
+        return myEntity;
+    }
+}
@@ -0,0 +1,60 @@
+#include "coli/game/prefab.h"
+
+namespace Coli::Game
+{
+    void Prefab::fail_not_exists() {
+        throw std::invalid_argument("Prefab doesn't contain a component of this type");
+    }
+
+    Prefab::Prefab() noexcept = default;
+
+    Prefab::Prefab(Prefab const& other)
+    {
+        myComponents.reserve(other.myComponents.size());
+
+        for (auto const& [id, component] : other.myComponents)
+            myComponents.emplace_back(id, component->clone());
+    }
+
+    Prefab::Prefab(Prefab&&) noexcept = default;
+
+    Prefab& Prefab::operator=(Prefab const& other)
+    {
+        if (this != &other)
+            *this = Prefab { other };
+
+        return *this;
+    }
+
+    Prefab& Prefab::operator=(Prefab&&) noexcept = default;
+
+    Prefab::~Prefab() noexcept = default;
+
+    std::size_t Prefab::size() const noexcept {
+        return myComponents.size();
+    }
+
+    bool Prefab::empty() const noexcept {
+        return myComponents.empty();
+    }
+
+    void Prefab::clear() noexcept {
+        myComponents.clear();
+    }
+
+    void Prefab::instantiate(Scene& scene, std::span<entt::entity> const entities) const
+    {
+        scene.create_many(entities);
+
+        for (auto const& [id, component] : myComponents)
+            component->instantiate(scene, entities);
+    }
+
+    std::vector<entt::entity> Prefab::instantiate(Scene& scene, std::size_t const count) const
+    {
+        std::vector<entt::entity> entities(count);
+        instantiate(scene, entities);
+
+        return entities;
+    }
+}
@@ -1,31 +1,221 @@
 #include "coli/game/scene.h"
-#include "coli/game/components/layer.h"
 
 namespace Coli::Game
 {
+    struct Scene::Reservations
+    {
+        std::atomic<entt::id_type> count { 0 };
+        entt::id_type first = 0;
+    };
+
+    struct Scene::Group
+    {
+        std::vector<entt::id_type> owned;
+        std::vector<entt::id_type> get;
+        std::vector<entt::id_type> excluded;
+    };
+
+    void Scene::fail_size_mismatch() {
+        throw std::invalid_argument("The count of components differs from the count of entities");
+    }
+
+    void Scene::fail_owned() {
+        throw std::invalid_argument("The component is already owned by another group");
+    }
+
+    void Scene::fail_sorted_owned() {
+        throw std::invalid_argument("The component sorted by layer cannot be owned by a group");
+    }
+
     Scene::Scene(Scene&&) noexcept = default;
     Scene& Scene::operator=(Scene&&) noexcept = default;
 
     Scene::~Scene() noexcept = default;
 
     Scene::Scene() :
-        myRegistry (std::make_shared<entt::registry>())
+        myRegistry     (std::make_shared<entt::registry>()),
+        mySlot         (*myRegistry),
+        myReservations (std::make_unique<Reservations>())
     {}
 
-    void Scene::reset() noexcept {
+    void Scene::reset() noexcept
+    {
+        mySlot = {};
         myRegistry.reset();
+        myGroups.clear();
+        myGroupTypes.clear();
     }
 
     bool Scene::is_valid() const noexcept {
         return static_cast<bool>(myRegistry);
     }
 
-    ObjectHandle Scene::create() {
-        return { myRegistry, myRegistry->create() };
+    std::uint32_t Scene::id() const noexcept {
+        return mySlot.id();
+    }
+
+    bool Scene::known_group(entt::id_type const type) const noexcept {
+        return std::ranges::binary_search(myGroupTypes, type);
+    }
+
+    void Scene::own(
+        entt::id_type const type,
+        std::initializer_list<entt::id_type> const owned,
+        std::initializer_list<entt::id_type> const get,
+        std::initializer_list<entt::id_type> const excluded)
+    {
+        auto const sorted = [] (std::initializer_list<entt::id_type> const ids) {
+            std::vector<entt::id_type> result { ids };
+            std::ranges::sort(result);
+
+            return result;
+        };
+
+        Group group { sorted(owned), sorted(get), sorted(excluded) };
+
+        auto const* const order = find_layer_order();
+
+        if (order && std::ranges::any_of(group.owned, [order] (entt::id_type const id) { return order->sorts(id); }))
+            fail_sorted_owned();
+
+        auto const same = std::ranges::any_of(myGroups, [&group] (Group const& other) {
+            return other.owned == group.owned && other.get == group.get && other.excluded == group.excluded;
+        });
+
+        if (!same)
+        {
+            for (auto const& other : myGroups)
+            {
+                auto const shared = std::ranges::any_of(group.owned, [&other] (entt::id_type const id) {
+                    return std::ranges::binary_search(other.owned, id);
+                });
+
+                if (shared)
+                    fail_owned();
+            }
+
+            myGroups.push_back(std::move(group));
+        }
+
+        // The same group may be requested by different types, e.g. with const components.
+        myGroupTypes.insert(std::ranges::upper_bound(myGroupTypes, type), type);
+    }
+
+    bool Scene::owned(entt::id_type const id) const noexcept
+    {
+        return std::ranges::any_of(myGroups, [id] (Group const& group) {
+            return std::ranges::binary_search(group.owned, id);
+        });
+    }
+
+    Detail::LayerOrder* Scene::find_layer_order() noexcept
+    {
+        if (!myRegistry)
+            return nullptr;
+
+        auto const* const order = myRegistry->ctx().find<std::unique_ptr<Detail::LayerOrder>>();
+        return order ? order->get() : nullptr;
+    }
+
+    Detail::LayerOrder& Scene::layer_order()
+    {
+        if (auto* const order = find_layer_order())
+            return *order;
+
+        if (owned(entt::type_hash<Components::Layer>::value()))
+            fail_sorted_owned();
+
+        // The order is owned by the registry, since its signals are connected to the
+        // order and the registry may outlive the scene in a scene access.
+        auto& order = *myRegistry->ctx().emplace<std::unique_ptr<Detail::LayerOrder>>(
+            std::make_unique<Detail::LayerOrder>());
+
+        myRegistry->on_construct<Components::Layer>().connect<&Detail::LayerOrder::touch>(order);
+        myRegistry->on_update<Components::Layer>().connect<&Detail::LayerOrder::touch>(order);
+        myRegistry->on_destroy<Components::Layer>().connect<&Detail::LayerOrder::touch>(order);
+
+        return order;
+    }
+
+    bool Scene::update_layer_order()
+    {
+        auto* const order = find_layer_order();
+        return order && order->update(*myRegistry);
+    }
+
+    void Scene::touch_layer_order() noexcept
+    {
+        if (auto* const order = find_layer_order())
+            order->written();
+    }
+
+    void Scene::create_reserved()
+    {
+        auto& reservations = *myReservations;
+        auto const count = reservations.count.exchange(0, std::memory_order_acquire);
+
+        for (entt::id_type i = 0; i < count; ++i)
+            static_cast<void>(myRegistry->create(static_cast<entt::entity>(reservations.first + i)));
+
+        reservations.first += count;
+    }
+
+    void Scene::created(entt::id_type const next) noexcept
+    {
+        auto& first = myReservations->first;
+        first = std::max<entt::id_type>(first, next);
+    }
+
+    ObjectHandle Scene::create()
+    {
+        create_reserved();
+
+        auto const entity = myRegistry->create();
+        created(entt::to_entity(entity) + 1);
+
+        return { myRegistry, entity };
+    }
+
+    std::vector<entt::entity> Scene::create_many(std::size_t const count)
+    {
+        std::vector<entt::entity> entities(count);
+        create_many(entities);
+
+        return entities;
+    }
+
+    ObjectHandle Scene::handle(entt::entity const entity) const noexcept {
+        return { myRegistry, entity };
+    }
+
+    entt::entity Scene::reserve() noexcept
+    {
+        auto& reservations = *myReservations;
+        auto const offset = reservations.count.fetch_add(1, std::memory_order_relaxed);
+
+        return static_cast<entt::entity>(reservations.first + offset);
     }
 
     void Scene::destroy(ObjectHandle const& handle) noexcept {
         if (handle.myRegistry.lock() == myRegistry && !handle.expired())
             myRegistry->destroy(handle.myHandle);
     }
+
+    ObjectRef Scene::ref(entt::entity const entity) const noexcept {
+        return { mySlot.id(), entity };
+    }
+
+    ObjectRef Scene::ref(ObjectHandle const& handle) const noexcept {
+        return { mySlot.id(), handle.entity() };
+    }
+
+    void Scene::swap_buffers() noexcept
+    {
+        if (!myRegistry)
+            return;
+
+        if (auto const* const buffers = myRegistry->ctx().find<std::vector<buffers_entry>>())
+            for (auto const& [id, state] : *buffers)
+                state->swap();
+    }
 }
@@ -0,0 +1,35 @@
+#include "coli/game/scene_access.h"
+
+namespace Coli::Game
+{
+    /* SceneAccess */
+
+    void SceneAccess::fail_on_expired() {
+        throw std::bad_weak_ptr();
+    }
+
+    SceneAccess::SceneAccess(Scene& scene) :
+        myOwner    (scene.myRegistry),
+        myRegistry (myOwner.get())
+    {
+        if (!myRegistry)
+            fail_on_expired();
+    }
+
+    SceneAccess::SceneAccess(ObjectHandle const& handle) :
+        myOwner    (handle.myRegistry.lock()),
+        myRegistry (myOwner.get())
+    {
+        if (!myRegistry)
+            fail_on_expired();
+    }
+
+    SceneAccess::SceneAccess(ObjectRef const& ref) :
+        myRegistry (Detail::SceneTable::resolve(ref.scene()))
+    {
+        if (!myRegistry)
+            fail_on_expired();
+    }
+
+    SceneAccess::~SceneAccess() noexcept = default;
+}
@@ -2,46 +2,569 @@
 
 namespace Coli::Generic
 {
+    struct Engine::Wakeup
+    {
+        struct Request
+        {
+            std::size_t steps = 0;
+            bool frame = false;
+        };
+
+        struct Timer
+        {
+            clock_type::time_point due;
+            std::function<void()> callback;
+        };
+
+        void notify() noexcept
+        {
+            // Taking the lock orders the notification after the waiter's checks.
+            {
+                std::lock_guard const lock { mutex };
+            }
+
+            condition.notify_all();
+
+            if (events.load(std::memory_order_acquire))
+                glfwPostEmptyEvent();
+        }
+
+        [[nodiscard]] Request wait(std::atomic<bool> const& stop)
+        {
+            std::unique_lock lock { mutex };
+
+            while (!stop.load(std::memory_order_acquire))
+            {
+                auto const now = clock_type::now();
+                auto const due = !timers.empty() && timers.front().due <= now;
+
+                if (steps != 0 || redraw || due || !posted.empty())
+                    return { std::exchange(steps, 0), std::exchange(redraw, false) || due || !posted.empty() };
+
+                if (events.load(std::memory_order_relaxed))
+                {
+                    std::optional<std::chrono::duration<double>> timeout;
+
+                    if (!timers.empty())
+                        timeout = timers.front().due - now;
+
+                    lock.unlock();
+
+                    if (timeout)
+                        glfwWaitEventsTimeout(timeout->count());
+                    else
+                        glfwWaitEvents();
+
+                    lock.lock();
+                }
+                else if (timers.empty())
+                    condition.wait(lock);
+                else
+                    condition.wait_until(lock, timers.front().due);
+            }
+
+            return {};
+        }
+
+        std::mutex mutex;
+        std::condition_variable condition;
+
+        std::vector<std::function<void()>> posted;
+        std::vector<Timer> timers;
+
+        std::size_t steps = 0;
+        bool redraw = false;
+
+        std::atomic<bool> events = false;
+    };
+
     /* Engine */
 
-    Engine::Engine(Engine&&) noexcept = default;
-    Engine& Engine::operator=(Engine&&) noexcept = default;
+    Engine::Engine(Engine&& other) noexcept :
+        myMain           (std::move(other.myMain)),
+        myShards         (std::move(other.myShards)),
+        myTasks          (std::move(other.myTasks)),
+        myWorkers        (std::move(other.myWorkers)),
+        myWorkerSettings (other.myWorkerSettings),
+        myLoop           (other.myLoop),
+        myStopFlag       (other.myStopFlag.load()),
+        myWakeup         (std::move(other.myWakeup))
+    {}
+
+    Engine& Engine::operator=(Engine&& other) noexcept
+    {
+        myMain = std::move(other.myMain);
+        myShards = std::move(other.myShards);
+        myTasks = std::move(other.myTasks);
+        myWorkers = std::move(other.myWorkers);
+        myWorkerSettings = other.myWorkerSettings;
+        myLoop = other.myLoop;
+        myStopFlag.store(other.myStopFlag.load());
+        myWakeup = std::move(other.myWakeup);
+
+        return *this;
+    }
 
     Engine::~Engine() noexcept = default;
 
-    Engine::Engine() noexcept(std::is_nothrow_default_constructible_v<decltype(mySystems)>) :
-        myStopFlag(false)
+    Engine::Engine() :
+        myTasks          (std::make_unique<TaskScheduler>()),
+        myStopFlag       (false),
+        myWakeup         (std::make_unique<Wakeup>())
     {}
 
-    void Engine::fail_already_exist() {
-        throw std::logic_error("The system already exists");
+    void Engine::fail_invalid_loop() {
+        throw std::invalid_argument("The loop step must be positive and the catch-up count non-zero");
+    }
+
+    void Engine::fail_empty_callback() {
+        throw std::invalid_argument("The posted callback is empty");
+    }
+
+    void Engine::fail_duplicate_scene() {
+        throw std::invalid_argument("The scene is already simulated by another shard");
+    }
+
+    void Engine::fail_moved_from() {
+        throw std::logic_error("The engine was moved from");
+    }
+
+    std::size_t Engine::default_worker_count() noexcept
+    {
+        auto const threads = std::thread::hardware_concurrency();
+        return threads > 1 ? threads - 1 : 0;
     }
 
     std::weak_ptr<Game::Scene const> Engine::active_scene() const noexcept {
-        return myScene;
+        return myMain.scene();
     }
 
     std::weak_ptr<Game::Scene> Engine::active_scene() noexcept {
-        return myScene;
+        return myMain.scene();
     }
 
-    void Engine::active_scene(std::weak_ptr<Game::Scene> scene) noexcept {
-        myScene = scene;
+    void Engine::active_scene(std::weak_ptr<Game::Scene> scene)
+    {
+        check_scene(scene, std::addressof(myMain));
+        myMain.scene(std::move(scene));
     }
 
-    void Engine::run()
+    void Engine::check_scene(std::weak_ptr<Game::Scene> const& scene, Shard const* const except) const
     {
-        myStopFlag = false;
+        auto const locked = scene.lock();
 
-        while (!myStopFlag)
-            if (auto const scene = myScene.lock()) [[likely]]
-                for (auto const& system : mySystems | std::views::values)
-                    system->execute(*scene);
-            else
+        if (!locked)
+            return;
+
+        // Two shards of the same registry would be ticked in parallel.
+        auto const simulates = [&locked, except] (Shard const& shard) {
+            return std::addressof(shard) != except && shard.scene().lock() == locked;
+        };
+
+        if (simulates(myMain) || std::ranges::any_of(myShards, [&simulates] (std::unique_ptr<Shard> const& shard) { return simulates(*shard); }))
+            fail_duplicate_scene();
+    }
+
+    Engine::LoopSettings const& Engine::loop_settings() const noexcept {
+        return myLoop;
+    }
+
+    void Engine::loop_settings(LoopSettings const& settings)
+    {
+        if (settings.step <= std::chrono::nanoseconds::zero() || settings.max_catch_up == 0)
+            fail_invalid_loop();
+
+        myLoop = settings;
+    }
+
+    void Engine::dispatch()
+    {
+        auto& wakeup = *myWakeup;
+        std::vector<std::function<void()>> callbacks;
+
+        {
+            std::lock_guard const lock { wakeup.mutex };
+
+            if (wakeup.posted.empty() && (wakeup.timers.empty() || wakeup.timers.front().due > clock_type::now()))
+                return;
+
+            callbacks.swap(wakeup.posted);
+
+            auto const now = clock_type::now();
+            auto const due = std::ranges::find_if(wakeup.timers, [now] (Wakeup::Timer const& timer) {
+                return timer.due > now;
+            });
+
+            for (auto timer = wakeup.timers.begin(); timer != due; ++timer)
+                callbacks.push_back(std::move(timer->callback));
+
+            wakeup.timers.erase(wakeup.timers.begin(), due);
+        }
+
+        for (auto const& callback : callbacks)
+            callback();
+    }
+
+    bool Engine::tick(std::chrono::nanoseconds const delta, Types::float_type const alpha)
+    {
+        dispatch();
+
+        if (myShards.empty())
+        {
+            myTasks->update(delta);
+            return myMain.tick(*myWorkers, delta, alpha);
+        }
+
+        struct Sharded
+        {
+            Shard& shard;
+            std::size_t steps;
+        };
+
+        JobCounter counter;
+        std::mutex errorMutex;
+        std::exception_ptr error;
+        auto alive = false;
+
+        auto const step_shard = [&] (Sharded const sharded) noexcept
+        {
+            auto& shard = sharded.shard;
+
+            auto const alpha = static_cast<Types::float_type>(shard.myAccumulated.count()) /
+                               static_cast<Types::float_type>(shard.myStep.count());
+
+            try {
+                for (std::size_t i = 0; i < sharded.steps; ++i)
+                    if (!shard.tick(*myWorkers, shard.myStep, alpha))
+                        break;
+            }
+            catch (...) {
+                std::lock_guard lock { errorMutex };
+
+                if (!error)
+                    error = std::current_exception();
+            }
+        };
+
+        for (auto const& shard : myShards)
+        {
+            alive = alive || !shard->myScene.expired();
+
+            if (auto const steps = shard->advance(delta, myLoop.max_catch_up); steps != 0)
+            {
+                try {
+                    myWorkers->submit([&step_shard, sharded = Sharded { *shard, steps }] {
+                        step_shard(sharded);
+                    }, counter);
+                }
+                catch (...) {
+                    step_shard({ *shard, steps });
+                }
+            }
+        }
+
+        try {
+            myTasks->update(delta);
+            alive = myMain.tick(*myWorkers, delta, alpha) || alive;
+        }
+        catch (...) {
+            myWorkers->wait(counter);
+            throw;
+        }
+
+        myWorkers->wait(counter);
+
+        if (error)
+            std::rethrow_exception(error);
+
+        return alive;
+    }
+
+    void Engine::run_continuous()
+    {
+        auto previous = clock_type::now();
+
+        while (!myStopFlag.load(std::memory_order_acquire))
+        {
+            auto const now = clock_type::now();
+            auto const delta = now - previous;
+
+            previous = now;
+
+            if (!tick(delta, 1))
+                break;
+        }
+    }
+
+    void Engine::run_fixed_step()
+    {
+        auto const step = myLoop.step;
+
+        auto previous = clock_type::now();
+        auto accumulated = std::chrono::nanoseconds::zero();
+
+        while (!myStopFlag.load(std::memory_order_acquire))
+        {
+            auto const now = clock_type::now();
+
+            accumulated += now - previous;
+            previous = now;
+
+            if (accumulated < step)
+            {
+                auto const deadline = now + (step - accumulated);
+
+                std::this_thread::sleep_until(deadline - sleep_margin);
+
+                while (clock_type::now() < deadline)
+                    std::this_thread::yield();
+
+                continue;
+            }
+
+            auto steps = static_cast<std::size_t>(accumulated / step);
+
+            if (steps > myLoop.max_catch_up) {
+                steps = myLoop.max_catch_up;
+                accumulated = step * steps + accumulated % step;
+            }
+
+            accumulated -= step * steps;
+
+            auto const alpha = static_cast<Types::float_type>(accumulated.count()) /
+                               static_cast<Types::float_type>(step.count());
+
+            for (std::size_t i = 0; i < steps && !myStopFlag.load(std::memory_order_acquire); ++i)
+                if (!tick(step, alpha))
+                    return;
+        }
+    }
+
+    void Engine::run_on_demand()
+    {
+        struct Guard
+        {
+            ~Guard() noexcept {
+                events.store(false, std::memory_order_release);
+            }
+
+            std::atomic<bool>& events;
+        };
+
+        auto& wakeup = *myWakeup;
+
+        Guard const guard { wakeup.events };
+        wakeup.events.store(myLoop.wait_events, std::memory_order_release);
+
+        while (!myStopFlag.load(std::memory_order_acquire))
+        {
+            auto const request = wakeup.wait(myStopFlag);
+
+            if (request.frame && request.steps == 0)
+                if (!tick(std::chrono::nanoseconds::zero(), 1))
+                    return;
+
+            for (std::size_t i = 0; i < request.steps && !myStopFlag.load(std::memory_order_acquire); ++i)
+                if (!tick(myLoop.step, 1))
+                    return;
+        }
+    }
+
+    void Engine::start_task(Task task) {
+        myTasks->start(std::move(task));
+    }
+
+    TaskScheduler const& Engine::tasks() const noexcept {
+        return *myTasks;
+    }
+
+    void Engine::start()
+    {
+        myStopFlag.store(false, std::memory_order_release);
+
+        static_cast<void>(workers());
+    }
+
+    Engine::WorkerSettings const& Engine::worker_settings() const noexcept {
+        return myWorkerSettings;
+    }
+
+    void Engine::worker_settings(WorkerSettings const& settings) noexcept
+    {
+        myWorkers.reset();
+        myWorkerSettings = settings;
+    }
+
+    WorkerPool& Engine::workers()
+    {
+        if (!myWorkers)
+        {
+            auto workers = std::make_unique<WorkerPool>(
+                myWorkerSettings.count.value_or(default_worker_count()),
+                myWorkerSettings.pin_threads);
+
+            myMain.resize(workers->slot_count());
+
+            for (auto const& shard : myShards)
+                shard->resize(workers->slot_count());
+
+            myWorkers = std::move(workers);
+        }
+
+        return *myWorkers;
+    }
+
+    FrameArena& Engine::arena() noexcept {
+        return myMain.arena();
+    }
+
+    FrameArena const& Engine::arena() const noexcept {
+        return myMain.arena();
+    }
+
+    FrameCommands& Engine::commands() noexcept {
+        return myMain.commands();
+    }
+
+    EventBus& Engine::events() noexcept {
+        return myMain.events();
+    }
+
+    FrameTimers& Engine::timers() noexcept {
+        return myMain.timers();
+    }
+
+    Shard& Engine::add_shard(std::weak_ptr<Game::Scene> scene, std::chrono::nanoseconds const step)
+    {
+        check_scene(scene, nullptr);
+
+        auto shard = std::make_unique<Shard>(std::move(scene), step);
+
+        if (myWorkers)
+            shard->resize(myWorkers->slot_count());
+
+        return *myShards.emplace_back(std::move(shard));
+    }
+
+    void Engine::remove_shard(Shard const& shard) noexcept
+    {
+        std::erase_if(myShards, [&shard] (std::unique_ptr<Shard> const& existing) {
+            return existing.get() == std::addressof(shard);
+        });
+    }
+
+    std::size_t Engine::shard_count() const noexcept {
+        return myShards.size();
+    }
+
+    Shard& Engine::shard(std::size_t const index) noexcept {
+        return *myShards[index];
+    }
+
+    Shard const& Engine::shard(std::size_t const index) const noexcept {
+        return *myShards[index];
+    }
+
+    FrameStats const& Engine::stats() const noexcept {
+        return myMain.stats();
+    }
+
+    void Engine::stats_capacity(std::size_t const capacity) {
+        myMain.stats_capacity(capacity);
+    }
+
+    FrameStats const& Engine::run_frames(std::size_t const count)
+    {
+        start();
+        myMain.clear_stats();
+
+        for (auto const& shard : myShards)
+            shard->clear_stats();
+
+        for (std::size_t i = 0; i < count && !myStopFlag.load(std::memory_order_acquire); ++i)
+            if (!tick(myLoop.step, 1))
                 break;
+
+        return myMain.stats();
+    }
+
+    void Engine::run()
+    {
+        start();
+
+        switch (myLoop.mode)
+        {
+        case LoopMode::FixedStep:
+            run_fixed_step();
+            break;
+
+        case LoopMode::OnDemand:
+            run_on_demand();
+            break;
+
+        case LoopMode::Continuous:
+        default:
+            run_continuous();
+            break;
+        }
+    }
+
+    void Engine::stop() noexcept
+    {
+        myStopFlag.store(true, std::memory_order_release);
+
+        if (myWakeup)
+            myWakeup->notify();
     }
 
-    void Engine::stop() noexcept {
-        myStopFlag = true;
+    void Engine::request_redraw() noexcept
+    {
+        if (!myWakeup)
+            return;
+
+        {
+            std::lock_guard const lock { myWakeup->mutex };
+            myWakeup->redraw = true;
+        }
+
+        myWakeup->notify();
+    }
+
+    void Engine::step(std::size_t const count) noexcept
+    {
+        if (!myWakeup)
+            return;
+
+        {
+            std::lock_guard const lock { myWakeup->mutex };
+            myWakeup->steps += count;
+        }
+
+        myWakeup->notify();
+    }
+
+    void Engine::post(std::function<void()> callback, std::chrono::nanoseconds const delay)
+    {
+        if (!callback)
+            fail_empty_callback();
+
+        if (!myWakeup)
+            fail_moved_from();
+
+        {
+            std::lock_guard const lock { myWakeup->mutex };
+
+            if (delay <= std::chrono::nanoseconds::zero())
+                myWakeup->posted.push_back(std::move(callback));
+            else
+            {
+                auto const due = clock_type::now() + delay;
+                auto const place = std::ranges::upper_bound(myWakeup->timers, due, {}, &Wakeup::Timer::due);
+
+                myWakeup->timers.insert(place, { due, std::move(callback) });
+            }
+        }
+
+        myWakeup->notify();
     }
 }
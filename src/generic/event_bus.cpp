@@ -0,0 +1,92 @@
+#include "coli/generic/event_bus.h"
+
+namespace Coli::Generic::Detail
+{
+    /* EventIndex */
+
+    std::size_t EventIndex::next() noexcept
+    {
+        static std::atomic<std::size_t> counter = 0;
+        return counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /* EventChannelBase */
+
+    EventChannelBase::EventChannelBase(entt::id_type const type) noexcept :
+        myType  (type),
+        myFrame (0),
+        myTotal (0)
+    {}
+
+    EventChannelBase::~EventChannelBase() noexcept = default;
+
+    entt::id_type EventChannelBase::type() const noexcept {
+        return myType;
+    }
+
+    std::size_t EventChannelBase::frame() const noexcept {
+        return myFrame;
+    }
+
+    std::uint64_t EventChannelBase::total() const noexcept {
+        return myTotal;
+    }
+
+    void EventChannelBase::count(std::size_t const events) noexcept
+    {
+        myFrame = events;
+        myTotal += events;
+    }
+}
+
+namespace Coli::Generic
+{
+    /* EventBus */
+
+    void EventBus::fail_too_many_types() {
+        throw std::length_error("Too many event types");
+    }
+
+    EventBus::EventBus(std::size_t const slots) :
+        myChannels (std::make_unique<std::atomic<Detail::EventChannelBase*>[]>(max_types)),
+        myMutex    (std::make_unique<std::mutex>()),
+        mySize     (std::max<std::size_t>(slots, 1)),
+        myOwner    (std::this_thread::get_id())
+    {}
+
+    EventBus::EventBus(EventBus&&) noexcept = default;
+    EventBus& EventBus::operator=(EventBus&&) noexcept = default;
+
+    EventBus::~EventBus() noexcept = default;
+
+    std::vector<EventCounter> EventBus::counters() const
+    {
+        std::lock_guard const lock { *myMutex };
+        std::vector<EventCounter> result;
+
+        result.reserve(myOwned.size());
+
+        for (auto const& channel : myOwned)
+            result.push_back({ channel->type(), channel->frame(), channel->total() });
+
+        return result;
+    }
+
+    std::size_t EventBus::size() const noexcept {
+        return mySize;
+    }
+
+    void EventBus::swap()
+    {
+        myOwner = std::this_thread::get_id();
+
+        for (auto const& channel : myOwned)
+            channel->swap();
+    }
+
+    void EventBus::clear() noexcept
+    {
+        for (auto const& channel : myOwned)
+            channel->clear();
+    }
+}
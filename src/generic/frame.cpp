@@ -0,0 +1,67 @@
+#include "coli/generic/frame.h"
+
+namespace Coli::Generic
+{
+    /* Frame */
+
+    Frame::Frame(
+        WorkerPool& workers,
+        FrameArena& arena,
+        FrameCommands& commands,
+        EventBus& events,
+        FrameTimers& timers,
+        Types::float_type const delta,
+        Types::float_type const alpha,
+        std::uint64_t const index) noexcept
+    :
+        myWorkers  (std::addressof(workers)),
+        myArena    (std::addressof(arena)),
+        myCommands (std::addressof(commands)),
+        myEvents   (std::addressof(events)),
+        myTimers   (std::addressof(timers)),
+        myDelta    (delta),
+        myAlpha    (alpha),
+        myIndex    (index)
+    {}
+
+    Frame::Frame(Frame const&) noexcept = default;
+    Frame& Frame::operator=(Frame const&) noexcept = default;
+
+    Frame::~Frame() noexcept = default;
+
+    WorkerPool& Frame::workers() const noexcept {
+        return *myWorkers;
+    }
+
+    FrameArena& Frame::arena() const noexcept {
+        return *myArena;
+    }
+
+    std::pmr::memory_resource* Frame::memory() const {
+        return std::addressof(myArena->local());
+    }
+
+    Game::CommandBuffer& Frame::commands() const {
+        return myCommands->local();
+    }
+
+    EventBus& Frame::events() const noexcept {
+        return *myEvents;
+    }
+
+    FrameTimers& Frame::timers() const noexcept {
+        return *myTimers;
+    }
+
+    Types::float_type Frame::delta() const noexcept {
+        return myDelta;
+    }
+
+    Types::float_type Frame::alpha() const noexcept {
+        return myAlpha;
+    }
+
+    std::uint64_t Frame::index() const noexcept {
+        return myIndex;
+    }
+}
@@ -0,0 +1,167 @@
+#include "coli/generic/frame_arena.h"
+#include "coli/generic/worker_pool.h"
+
+namespace Coli::Generic
+{
+    /* LinearArena */
+
+    LinearArena::LinearArena(std::size_t const block_size) noexcept :
+        myCurrent   (nullptr),
+        myOffset    (0),
+        myBlockSize (std::max(block_size, Utility::cache_line_size)),
+        myCapacity  (0),
+        myUsed      (0),
+        myHighWater (0)
+    {}
+
+    LinearArena::LinearArena(LinearArena&& other) noexcept :
+        myBlocks    (std::move(other.myBlocks)),
+        myCurrent   (std::exchange(other.myCurrent, nullptr)),
+        myOffset    (std::exchange(other.myOffset, 0)),
+        myBlockSize (std::exchange(other.myBlockSize, 0)),
+        myCapacity  (std::exchange(other.myCapacity, 0)),
+        myUsed      (std::exchange(other.myUsed, 0)),
+        myHighWater (std::exchange(other.myHighWater, 0))
+    {}
+
+    LinearArena& LinearArena::operator=(LinearArena&& other) noexcept
+    {
+        myBlocks = std::move(other.myBlocks);
+        myCurrent = std::exchange(other.myCurrent, nullptr);
+        myOffset = std::exchange(other.myOffset, 0);
+        myBlockSize = std::exchange(other.myBlockSize, 0);
+        myCapacity = std::exchange(other.myCapacity, 0);
+        myUsed = std::exchange(other.myUsed, 0);
+        myHighWater = std::exchange(other.myHighWater, 0);
+
+        return *this;
+    }
+
+    LinearArena::~LinearArena() noexcept = default;
+
+    void LinearArena::add_block(std::size_t const size)
+    {
+        myBlocks.reserve(myBlocks.size() + 1);
+        myBlocks.push_back(std::make_unique_for_overwrite<std::byte[]>(size));
+
+        myCurrent = myBlocks.back().get();
+        myOffset = 0;
+        myBlockSize = size;
+        myCapacity += size;
+    }
+
+    void LinearArena::reset()
+    {
+        myHighWater = std::max(myHighWater, myUsed);
+        myUsed = 0;
+        myOffset = 0;
+
+        if (myBlocks.size() > 1)
+        {
+            auto const size = myCapacity;
+
+            myBlocks.clear();
+            myCapacity = 0;
+
+            add_block(size);
+        }
+    }
+
+    std::size_t LinearArena::used() const noexcept {
+        return myUsed;
+    }
+
+    std::size_t LinearArena::capacity() const noexcept {
+        return myCapacity;
+    }
+
+    std::size_t LinearArena::high_water() const noexcept {
+        return std::max(myHighWater, myUsed);
+    }
+
+    void* LinearArena::do_allocate(std::size_t const bytes, std::size_t const alignment)
+    {
+        auto const address = reinterpret_cast<std::uintptr_t>(myCurrent) + myOffset;
+        auto padding = (alignment - address % alignment) % alignment;
+
+        if (!myCurrent || myOffset + padding + bytes > myBlockSize)
+        {
+            auto const grown = myCurrent ? myBlockSize * 2 : myBlockSize;
+            add_block(std::max(grown, bytes + alignment));
+
+            auto const fresh = reinterpret_cast<std::uintptr_t>(myCurrent);
+            padding = (alignment - fresh % alignment) % alignment;
+        }
+
+        auto* const result = myCurrent + myOffset + padding;
+
+        myOffset += padding + bytes;
+        myUsed += padding + bytes;
+
+        return result;
+    }
+
+    void LinearArena::do_deallocate(void*, std::size_t, std::size_t)
+    {}
+
+    bool LinearArena::do_is_equal(std::pmr::memory_resource const& other) const noexcept {
+        return this == std::addressof(other);
+    }
+
+    /* FrameArena */
+
+    FrameArena::FrameArena(std::size_t const slots, std::size_t const block_size) :
+        mySlots (std::make_unique<Slot[]>(std::max<std::size_t>(slots, 1))),
+        mySize  (std::max<std::size_t>(slots, 1))
+    {
+        for (std::size_t i = 0; i < mySize; ++i)
+            mySlots[i].arena = LinearArena { block_size };
+    }
+
+    FrameArena::FrameArena(FrameArena&& other) noexcept :
+        mySlots (std::move(other.mySlots)),
+        mySize  (std::exchange(other.mySize, 0))
+    {}
+
+    FrameArena& FrameArena::operator=(FrameArena&& other) noexcept
+    {
+        mySlots = std::move(other.mySlots);
+        mySize = std::exchange(other.mySize, 0);
+
+        return *this;
+    }
+
+    FrameArena::~FrameArena() noexcept = default;
+
+    LinearArena& FrameArena::local() {
+        return mySlots[WorkerPool::current_slot(mySize)].arena;
+    }
+
+    LinearArena& FrameArena::operator[](std::size_t const slot) noexcept {
+        return mySlots[slot].arena;
+    }
+
+    LinearArena const& FrameArena::operator[](std::size_t const slot) const noexcept {
+        return mySlots[slot].arena;
+    }
+
+    std::size_t FrameArena::size() const noexcept {
+        return mySize;
+    }
+
+    void FrameArena::reset()
+    {
+        for (std::size_t i = 0; i < mySize; ++i)
+            mySlots[i].arena.reset();
+    }
+
+    std::size_t FrameArena::high_water() const noexcept
+    {
+        std::size_t result = 0;
+
+        for (std::size_t i = 0; i < mySize; ++i)
+            result += mySlots[i].arena.high_water();
+
+        return result;
+    }
+}
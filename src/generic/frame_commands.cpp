@@ -0,0 +1,58 @@
+#include "coli/generic/frame_commands.h"
+#include "coli/generic/worker_pool.h"
+
+namespace Coli::Generic
+{
+    FrameCommands::FrameCommands(std::size_t const slots) :
+        mySlots (std::make_unique<Slot[]>(std::max<std::size_t>(slots, 1))),
+        mySize  (std::max<std::size_t>(slots, 1))
+    {
+        myBuffers.reserve(mySize);
+
+        for (std::size_t i = 0; i < mySize; ++i)
+            myBuffers.push_back(std::addressof(mySlots[i].buffer));
+    }
+
+    FrameCommands::FrameCommands(FrameCommands&& other) noexcept :
+        mySlots   (std::move(other.mySlots)),
+        myBuffers (std::move(other.myBuffers)),
+        mySize    (std::exchange(other.mySize, 0))
+    {}
+
+    FrameCommands& FrameCommands::operator=(FrameCommands&& other) noexcept
+    {
+        mySlots = std::move(other.mySlots);
+        myBuffers = std::move(other.myBuffers);
+        mySize = std::exchange(other.mySize, 0);
+
+        return *this;
+    }
+
+    FrameCommands::~FrameCommands() noexcept = default;
+
+    Game::CommandBuffer& FrameCommands::local() {
+        return mySlots[WorkerPool::current_slot(mySize)].buffer;
+    }
+
+    Game::CommandBuffer& FrameCommands::operator[](std::size_t const slot) noexcept {
+        return mySlots[slot].buffer;
+    }
+
+    Game::CommandBuffer const& FrameCommands::operator[](std::size_t const slot) const noexcept {
+        return mySlots[slot].buffer;
+    }
+
+    std::size_t FrameCommands::size() const noexcept {
+        return mySize;
+    }
+
+    void FrameCommands::bind(Game::Scene& scene) noexcept
+    {
+        for (std::size_t i = 0; i < mySize; ++i)
+            mySlots[i].buffer.bind(scene);
+    }
+
+    void FrameCommands::flush(Game::Scene& scene) {
+        Game::CommandBuffer::flush(scene, myBuffers);
+    }
+}
@@ -0,0 +1,79 @@
+#include "coli/generic/run_policy.h"
+
+namespace Coli::Generic
+{
+    RunPolicy::RunPolicy() noexcept :
+        myMode   (Mode::Always),
+        myPeriod (0),
+        myFrames (1),
+        myTime   (std::chrono::nanoseconds::zero())
+    {}
+
+    RunPolicy::RunPolicy(RunPolicy const&) noexcept = default;
+    RunPolicy& RunPolicy::operator=(RunPolicy const&) noexcept = default;
+
+    RunPolicy::~RunPolicy() noexcept = default;
+
+    void RunPolicy::fail_invalid_argument(std::string_view msg) {
+        throw std::invalid_argument(msg.data());
+    }
+
+    RunPolicy RunPolicy::always() noexcept {
+        return {};
+    }
+
+    RunPolicy RunPolicy::rate(Types::float_type const hertz)
+    {
+        if (!(hertz > 0))
+            fail_invalid_argument("The rate must be positive");
+
+        RunPolicy result;
+
+        result.myMode = Mode::Rate;
+        result.myPeriod = 1 / hertz;
+
+        return result;
+    }
+
+    RunPolicy RunPolicy::every(std::uint64_t const frames)
+    {
+        if (frames == 0)
+            fail_invalid_argument("The interval must be non-zero");
+
+        RunPolicy result;
+
+        result.myMode = Mode::Interval;
+        result.myFrames = frames;
+
+        return result;
+    }
+
+    RunPolicy RunPolicy::budget(std::chrono::nanoseconds const time)
+    {
+        if (time <= std::chrono::nanoseconds::zero())
+            fail_invalid_argument("The time budget must be positive");
+
+        RunPolicy result;
+
+        result.myMode = Mode::Budget;
+        result.myTime = time;
+
+        return result;
+    }
+
+    RunPolicy::Mode RunPolicy::mode() const noexcept {
+        return myMode;
+    }
+
+    Types::float_type RunPolicy::period() const noexcept {
+        return myPeriod;
+    }
+
+    std::uint64_t RunPolicy::frames() const noexcept {
+        return myFrames;
+    }
+
+    std::chrono::nanoseconds RunPolicy::time() const noexcept {
+        return myTime;
+    }
+}
@@ -0,0 +1,161 @@
+#include "coli/generic/scheduler.h"
+
+namespace Coli::Generic
+{
+    /* Scheduler */
+
+    struct Scheduler::Execution
+    {
+        Game::Scene& scene;
+        Frame const& frame;
+
+        std::atomic<std::size_t> pending;
+
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+    Scheduler::Scheduler() noexcept :
+        myIsDirty (false)
+    {}
+
+    Scheduler::Scheduler(Scheduler&&) noexcept = default;
+    Scheduler& Scheduler::operator=(Scheduler&&) noexcept = default;
+
+    Scheduler::~Scheduler() noexcept = default;
+
+    void Scheduler::add(std::shared_ptr<Detail::SystemBase> system)
+    {
+        auto access = system->access();
+
+        myNodes.push_back({ std::move(system), std::move(access), {}, 0 });
+        myIsDirty = true;
+    }
+
+    void Scheduler::remove(Detail::SystemBase const* system) noexcept
+    {
+        auto const erased = std::erase_if(myNodes, [system] (Node const& node) {
+            return node.system.get() == system;
+        });
+
+        if (erased != 0)
+            myIsDirty = true;
+    }
+
+    std::size_t Scheduler::size() const noexcept {
+        return myNodes.size();
+    }
+
+    void Scheduler::rebuild()
+    {
+        for (auto& node : myNodes) {
+            node.dependents.clear();
+            node.dependencies = 0;
+        }
+
+        for (std::size_t later = 0; later < myNodes.size(); ++later)
+            for (std::size_t earlier = 0; earlier < later; ++earlier)
+                if (myNodes[earlier].access.conflicts(myNodes[later].access))
+                {
+                    myNodes[earlier].dependents.push_back(later);
+                    ++myNodes[later].dependencies;
+                }
+
+        myRemaining = std::make_unique<std::atomic<std::size_t>[]>(myNodes.size());
+        myTimings.assign(myNodes.size(), {});
+
+        for (std::size_t i = 0; i < myNodes.size(); ++i)
+            myTimings[i].system = myNodes[i].system.get();
+
+        myIsDirty = false;
+    }
+
+    void Scheduler::run_timed(Game::Scene& scene, Frame const& frame, std::size_t const index)
+    {
+        auto& system = *myNodes[index].system;
+        auto& timing = myTimings[index];
+
+        auto const start = std::chrono::steady_clock::now();
+
+        system.run(scene, frame);
+
+        timing.time = std::chrono::steady_clock::now() - start;
+        timing.processed = system.processed();
+    }
+
+    void Scheduler::run_node(Execution& execution, std::size_t index) noexcept
+    {
+        auto const& node = myNodes[index];
+
+        try {
+            run_timed(execution.scene, execution.frame, index);
+        }
+        catch (...) {
+            std::lock_guard lock { execution.errorMutex };
+
+            if (!execution.error)
+                execution.error = std::current_exception();
+        }
+
+        for (auto const dependent : node.dependents)
+            if (myRemaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                try {
+                    execution.frame.workers().submit([this, &execution, dependent] {
+                        run_node(execution, dependent);
+                    });
+                }
+                catch (...) {
+                    run_node(execution, dependent);
+                }
+            }
+
+        execution.pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    void Scheduler::execute(Game::Scene& scene, Frame const& frame)
+    {
+        auto& workers = frame.workers();
+
+        if (myIsDirty)
+            rebuild();
+
+        for (auto const& node : myNodes)
+            node.system->prepare(scene, frame);
+
+        if (workers.worker_count() == 0 || myNodes.size() < 2)
+        {
+            for (std::size_t i = 0; i < myNodes.size(); ++i)
+                run_timed(scene, frame, i);
+
+            return;
+        }
+
+        Execution execution { scene, frame, myNodes.size(), {}, nullptr };
+
+        for (std::size_t i = 0; i < myNodes.size(); ++i)
+            myRemaining[i].store(myNodes[i].dependencies, std::memory_order_relaxed);
+
+        for (std::size_t i = 0; i < myNodes.size(); ++i)
+            if (myNodes[i].dependencies == 0)
+            {
+                try {
+                    workers.submit([this, &execution, i] {
+                        run_node(execution, i);
+                    });
+                }
+                catch (...) {
+                    run_node(execution, i);
+                }
+            }
+
+        workers.wait(execution.pending);
+
+        if (execution.error)
+            std::rethrow_exception(execution.error);
+    }
+
+    std::span<SystemTiming const> Scheduler::timings() const noexcept {
+        return myTimings;
+    }
+}
@@ -0,0 +1,144 @@
+#include "coli/generic/shard.h"
+
+namespace Coli::Generic
+{
+    /* Shard */
+
+    void Shard::fail_already_exist() {
+        throw std::logic_error("The system already exists");
+    }
+
+    void Shard::fail_invalid_step() {
+        throw std::invalid_argument("The shard step must be positive");
+    }
+
+    Shard::Shard(std::weak_ptr<Game::Scene> scene, std::chrono::nanoseconds const step) :
+        myScene       (std::move(scene)),
+        myStep        (step),
+        myAccumulated (std::chrono::nanoseconds::zero()),
+        myFrameIndex  (0)
+    {
+        if (step <= std::chrono::nanoseconds::zero())
+            fail_invalid_step();
+    }
+
+    Shard::Shard(Shard&&) noexcept = default;
+    Shard& Shard::operator=(Shard&&) noexcept = default;
+
+    Shard::~Shard() noexcept = default;
+
+    std::weak_ptr<Game::Scene> Shard::scene() const noexcept {
+        return myScene;
+    }
+
+    void Shard::scene(std::weak_ptr<Game::Scene> scene) noexcept {
+        myScene = std::move(scene);
+    }
+
+    std::chrono::nanoseconds Shard::step() const noexcept {
+        return myStep;
+    }
+
+    void Shard::step(std::chrono::nanoseconds const step)
+    {
+        if (step <= std::chrono::nanoseconds::zero())
+            fail_invalid_step();
+
+        myStep = step;
+    }
+
+    std::uint64_t Shard::frames() const noexcept {
+        return myFrameIndex;
+    }
+
+    FrameArena& Shard::arena() noexcept {
+        return myArena;
+    }
+
+    FrameArena const& Shard::arena() const noexcept {
+        return myArena;
+    }
+
+    FrameCommands& Shard::commands() noexcept {
+        return myCommands;
+    }
+
+    EventBus& Shard::events() noexcept {
+        return myEvents;
+    }
+
+    EventBus const& Shard::events() const noexcept {
+        return myEvents;
+    }
+
+    FrameTimers& Shard::timers() noexcept {
+        return myTimers;
+    }
+
+    FrameTimers const& Shard::timers() const noexcept {
+        return myTimers;
+    }
+
+    FrameStats const& Shard::stats() const noexcept {
+        return myStats;
+    }
+
+    void Shard::clear_stats() noexcept {
+        myStats.clear();
+    }
+
+    void Shard::stats_capacity(std::size_t const capacity) {
+        myStats = FrameStats { capacity };
+    }
+
+    void Shard::resize(std::size_t const slots)
+    {
+        myArena = FrameArena { slots };
+        myCommands = FrameCommands { slots };
+        myEvents = EventBus { slots };
+        myTimers.resize(slots);
+    }
+
+    std::size_t Shard::advance(std::chrono::nanoseconds const delta, std::size_t const max_catch_up) noexcept
+    {
+        myAccumulated += delta;
+
+        auto steps = static_cast<std::size_t>(myAccumulated / myStep);
+
+        if (steps > max_catch_up) {
+            steps = max_catch_up;
+            myAccumulated = myStep * steps + myAccumulated % myStep;
+        }
+
+        myAccumulated -= myStep * steps;
+        return steps;
+    }
+
+    bool Shard::tick(WorkerPool& workers, std::chrono::nanoseconds const delta, Types::float_type const alpha)
+    {
+        if (auto const scene = myScene.lock()) [[likely]]
+        {
+            auto const start = clock_type::now();
+            std::chrono::duration<Types::float_type> const seconds = delta;
+
+            myCommands.bind(*scene);
+
+            // The timers count the frames of the simulated time, not the redraws.
+            if (delta > std::chrono::nanoseconds::zero())
+                myTimers.advance();
+
+            scene->update_layer_order();
+            myScheduler.execute(*scene, Frame { workers, myArena, myCommands, myEvents, myTimers, seconds.count(), alpha, myFrameIndex++ });
+            myCommands.flush(*scene);
+            myTimers.flush();
+            scene->swap_buffers();
+            myEvents.swap();
+            myStats.record(clock_type::now() - start, myScheduler.timings());
+            myArena.reset();
+
+            return true;
+        }
+
+        return false;
+    }
+}
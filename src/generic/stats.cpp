@@ -0,0 +1,160 @@
+#include "coli/generic/stats.h"
+
+namespace Coli::Generic
+{
+    /* FrameStats */
+
+    FrameStats::FrameStats(std::size_t const capacity) :
+        myCapacity (capacity),
+        myRecorded (0)
+    {
+        if (capacity == 0)
+            fail_zero_capacity();
+
+        myTimes = std::make_unique<std::atomic<std::int64_t>[]>(capacity);
+    }
+
+    FrameStats::FrameStats(FrameStats&& other) noexcept :
+        myCapacity (other.myCapacity),
+        myTimes    (std::move(other.myTimes)),
+        myColumns  (std::move(other.myColumns)),
+        myRecorded (other.myRecorded.load())
+    {}
+
+    FrameStats& FrameStats::operator=(FrameStats&& other) noexcept
+    {
+        myCapacity = other.myCapacity;
+        myTimes = std::move(other.myTimes);
+        myColumns = std::move(other.myColumns);
+        myRecorded.store(other.myRecorded.load());
+
+        return *this;
+    }
+
+    FrameStats::~FrameStats() noexcept = default;
+
+    void FrameStats::fail_zero_capacity() {
+        throw std::invalid_argument("The statistics capacity must be non-zero");
+    }
+
+    StatsSummary FrameStats::summarize(
+        std::atomic<std::int64_t> const* const times,
+        std::atomic<std::size_t> const* const processed,
+        std::uint64_t const since) const
+    {
+        auto const recorded = myRecorded.load(std::memory_order_acquire);
+        auto const count = static_cast<std::size_t>(
+            std::min<std::uint64_t>(recorded - std::min(recorded, since), myCapacity));
+
+        StatsSummary result;
+
+        if (count == 0)
+            return result;
+
+        std::vector<std::int64_t> samples (count);
+        std::uint64_t total = 0;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            auto const slot = static_cast<std::size_t>((recorded - 1 - i) % myCapacity);
+
+            samples[i] = times[slot].load(std::memory_order_relaxed);
+
+            if (processed)
+                total += processed[slot].load(std::memory_order_relaxed);
+        }
+
+        std::ranges::sort(samples);
+
+        auto const percentile = [&samples, count] (std::size_t const percent) {
+            auto const rank = (percent * count + 99) / 100;
+            return std::chrono::nanoseconds(samples[std::max<std::size_t>(rank, 1) - 1]);
+        };
+
+        result.samples = count;
+        result.p50 = percentile(50);
+        result.p95 = percentile(95);
+        result.p99 = percentile(99);
+        result.max = std::chrono::nanoseconds(samples.back());
+        result.processed = static_cast<std::size_t>(total / count);
+
+        return result;
+    }
+
+    bool FrameStats::same_systems(std::span<SystemTiming const> const systems) const noexcept
+    {
+        return std::ranges::equal(myColumns, systems, {},
+            &Column::system, &SystemTiming::system);
+    }
+
+    void FrameStats::reset_columns(std::span<SystemTiming const> const systems)
+    {
+        auto const recorded = myRecorded.load(std::memory_order_relaxed);
+        std::vector<Column> columns;
+
+        columns.reserve(systems.size());
+
+        for (auto const& timing : systems)
+        {
+            auto const existing = std::ranges::find(myColumns, timing.system, &Column::system);
+
+            if (existing != myColumns.end() && existing->times)
+                columns.push_back(std::move(*existing));
+            else
+                columns.push_back({
+                    timing.system,
+                    recorded,
+                    std::make_unique<std::atomic<std::int64_t>[]>(myCapacity),
+                    std::make_unique<std::atomic<std::size_t>[]>(myCapacity)
+                });
+        }
+
+        myColumns = std::move(columns);
+    }
+
+    std::size_t FrameStats::capacity() const noexcept {
+        return myCapacity;
+    }
+
+    std::uint64_t FrameStats::recorded() const noexcept {
+        return myRecorded.load(std::memory_order_acquire);
+    }
+
+    void FrameStats::record(std::chrono::nanoseconds const time, std::span<SystemTiming const> const systems)
+    {
+        if (!same_systems(systems))
+            reset_columns(systems);
+
+        auto const recorded = myRecorded.load(std::memory_order_relaxed);
+        auto const slot = static_cast<std::size_t>(recorded % myCapacity);
+
+        myTimes[slot].store(time.count(), std::memory_order_relaxed);
+
+        for (std::size_t i = 0; i < systems.size(); ++i) {
+            myColumns[i].times[slot].store(systems[i].time.count(), std::memory_order_relaxed);
+            myColumns[i].processed[slot].store(systems[i].processed, std::memory_order_relaxed);
+        }
+
+        myRecorded.store(recorded + 1, std::memory_order_release);
+    }
+
+    void FrameStats::clear() noexcept
+    {
+        myColumns.clear();
+        myRecorded.store(0, std::memory_order_release);
+    }
+
+    StatsSummary FrameStats::frame() const {
+        return summarize(myTimes.get(), nullptr, 0);
+    }
+
+    StatsSummary FrameStats::system(Detail::SystemBase const& system) const
+    {
+        auto const column = std::ranges::find(myColumns, std::addressof(system), &Column::system);
+
+        if (column == myColumns.end())
+            return {};
+
+        return summarize(column->times.get(), column->processed.get(), column->since);
+    }
+}
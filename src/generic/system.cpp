@@ -1,8 +1,85 @@
 #include "coli/generic/system.h"
 
+namespace Coli::Generic
+{
+    /* SystemAccess */
+
+    SystemAccess::SystemAccess() noexcept :
+        myIsExclusive (true)
+    {}
+
+    SystemAccess::SystemAccess(SystemAccess const&) = default;
+    SystemAccess::SystemAccess(SystemAccess&&) noexcept = default;
+
+    SystemAccess& SystemAccess::operator=(SystemAccess const&) = default;
+    SystemAccess& SystemAccess::operator=(SystemAccess&&) noexcept = default;
+
+    SystemAccess::~SystemAccess() noexcept = default;
+
+    bool SystemAccess::intersects(
+        std::vector<entt::id_type> const& first,
+        std::vector<entt::id_type> const& second) noexcept
+    {
+        auto left = first.begin();
+        auto right = second.begin();
+
+        while (left != first.end() && right != second.end())
+            if (*left < *right)
+                ++left;
+            else if (*right < *left)
+                ++right;
+            else
+                return true;
+
+        return false;
+    }
+
+    void SystemAccess::insert(std::vector<entt::id_type>& ids, entt::id_type id)
+    {
+        auto const place = std::ranges::lower_bound(ids, id);
+
+        if (place == ids.end() || *place != id)
+            ids.insert(place, id);
+    }
+
+    bool SystemAccess::is_exclusive() const noexcept {
+        return myIsExclusive;
+    }
+
+    bool SystemAccess::conflicts(SystemAccess const& other) const noexcept
+    {
+        if (myIsExclusive || other.myIsExclusive)
+            return true;
+
+        return intersects(myWrites, other.myWrites) ||
+               intersects(myWrites, other.myReads) ||
+               intersects(myReads, other.myWrites);
+    }
+}
+
 namespace Coli::Generic::Detail
 {
-    SystemBase::SystemBase() noexcept = default;
+    std::size_t SystemIndex::next() noexcept
+    {
+        static std::atomic<std::size_t> counter = 0;
+        return counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void SystemBase::fail_unsupported_policy() {
+        throw std::invalid_argument("The system does not support the budget policy");
+    }
+
+    SystemBase::SystemBase() noexcept :
+        myFrame      (nullptr),
+        myProcessed  (0),
+        myElapsed    (0),
+        myWaited     (0),
+        myFrames     (0),
+        myCursor     (0),
+        mySliceSize  (0),
+        myCost       (0),
+        mySliceStart ()
+    {}
 
     SystemBase::SystemBase(SystemBase const&) noexcept = default;
     SystemBase::SystemBase(SystemBase&&) noexcept = default;
@@ -11,4 +88,139 @@ namespace Coli::Generic::Detail
     SystemBase& SystemBase::operator=(SystemBase&&) noexcept = default;
 
     SystemBase::~SystemBase() noexcept = default;
-}
\ No newline at end of file
+
+    Generic::SystemAccess SystemBase::access() const {
+        return {};
+    }
+
+    bool SystemBase::supports_budget() const noexcept {
+        return false;
+    }
+
+    void SystemBase::prepare(Game::Scene&, Generic::Frame const&)
+    {}
+
+    void SystemBase::run(Game::Scene& scene, Generic::Frame const& frame)
+    {
+        struct Guard
+        {
+            ~Guard() noexcept {
+                current = nullptr;
+                elapsed = 0;
+            }
+
+            Generic::Frame const*& current;
+            Types::float_type& elapsed;
+        };
+
+        myProcessed = 0;
+        myElapsed += frame.delta();
+
+        if (!is_due(frame.delta()))
+            return;
+
+        Guard const guard { myFrame, myElapsed };
+        myFrame = std::addressof(frame);
+
+        execute(scene, frame);
+    }
+
+    std::size_t SystemBase::processed() const noexcept {
+        return myProcessed;
+    }
+
+    Generic::RunPolicy const& SystemBase::run_policy() const noexcept {
+        return myPolicy;
+    }
+
+    void SystemBase::run_policy(Generic::RunPolicy const& policy)
+    {
+        if (policy.mode() == Generic::RunPolicy::Mode::Budget && !supports_budget())
+            fail_unsupported_policy();
+
+        myPolicy = policy;
+        myWaited = policy.period();
+        myFrames = policy.frames();
+        myCursor = 0;
+        myCost = 0;
+    }
+
+    Generic::Frame const& SystemBase::frame() const noexcept {
+        return *myFrame;
+    }
+
+    Types::float_type SystemBase::elapsed() const noexcept {
+        return myElapsed;
+    }
+
+    void SystemBase::count_processed(std::size_t const count) noexcept {
+        myProcessed += count;
+    }
+
+    bool SystemBase::is_due(Types::float_type const delta) noexcept
+    {
+        switch (myPolicy.mode())
+        {
+        case Generic::RunPolicy::Mode::Rate:
+        {
+            auto const period = myPolicy.period();
+            myWaited += delta;
+
+            if (myWaited < period)
+                return false;
+
+            myWaited = std::min(myWaited - period, period);
+            return true;
+        }
+
+        case Generic::RunPolicy::Mode::Interval:
+            if (++myFrames < myPolicy.frames())
+                return false;
+
+            myFrames = 0;
+            return true;
+
+        default:
+            return true;
+        }
+    }
+
+    std::pair<std::size_t, std::size_t> SystemBase::begin_slice(std::size_t const size) noexcept
+    {
+        // Count of objects processed before the cost is measured.
+        static constexpr std::size_t probe = 64;
+
+        mySliceSize = size;
+        mySliceStart = clock_type::now();
+
+        if (size == 0)
+            return { 0, 0 };
+
+        myCursor %= size;
+
+        if (myCost <= 0)
+            return { myCursor, std::min(size, probe) };
+
+        auto const budget = static_cast<double>(myPolicy.time().count());
+        auto const fits = static_cast<std::size_t>(budget / myCost);
+
+        return { myCursor, std::clamp<std::size_t>(fits, 1, size) };
+    }
+
+    bool SystemBase::slice_exhausted() const noexcept {
+        return clock_type::now() - mySliceStart >= myPolicy.time();
+    }
+
+    void SystemBase::end_slice(std::size_t const visited) noexcept
+    {
+        if (visited == 0)
+            return;
+
+        std::chrono::duration<double, std::nano> const time = clock_type::now() - mySliceStart;
+        auto const cost = time.count() / static_cast<double>(visited);
+
+        // Rises at once to hold the budget under spikes, falls smoothly.
+        myCost = cost > myCost ? cost : myCost + (cost - myCost) / 8;
+        myCursor = (myCursor + visited) % mySliceSize;
+    }
+}
@@ -0,0 +1,294 @@
+#include "coli/generic/task.h"
+
+namespace Coli::Generic::Detail
+{
+    namespace
+    {
+        class FramePool final
+        {
+            static constexpr std::size_t granularity = 64;
+            static constexpr std::size_t class_count = 16;
+            static constexpr std::size_t blocks_per_slab = 32;
+
+            struct FreeBlock {
+                FreeBlock* next;
+            };
+
+        public:
+            static constexpr std::size_t max_size = granularity * class_count;
+
+            [[nodiscard]] static std::size_t class_of(std::size_t const size) noexcept {
+                return (size + granularity - 1) / granularity - 1;
+            }
+
+            [[nodiscard]] void* allocate(std::size_t const size)
+            {
+                auto const index = class_of(size);
+                std::lock_guard lock { myMutex };
+
+                if (!myFree[index])
+                    grow(index);
+
+                auto* const block = myFree[index];
+                myFree[index] = block->next;
+
+                return block;
+            }
+
+            void deallocate(void* const pointer, std::size_t const size) noexcept
+            {
+                auto const index = class_of(size);
+                std::lock_guard lock { myMutex };
+
+                myFree[index] = ::new (pointer) FreeBlock { myFree[index] };
+            }
+
+        private:
+            void grow(std::size_t const index)
+            {
+                auto const blockSize = (index + 1) * granularity;
+                auto& slab = mySlabs.emplace_back(std::make_unique<std::byte[]>(blockSize * blocks_per_slab));
+
+                for (auto i = blocks_per_slab; i-- > 0; )
+                    myFree[index] = ::new (slab.get() + i * blockSize) FreeBlock { myFree[index] };
+            }
+
+            std::mutex myMutex;
+            std::array<FreeBlock*, class_count> myFree {};
+            std::vector<std::unique_ptr<std::byte[]>> mySlabs;
+        };
+
+        [[nodiscard]] FramePool& frame_pool()
+        {
+            // Never destroyed: frames of static tasks may outlive it otherwise.
+            static auto* const pool = new FramePool;
+            return *pool;
+        }
+    }
+
+    void* TaskFramePool::allocate(std::size_t const size)
+    {
+        if (size > FramePool::max_size)
+            return ::operator new(size);
+
+        return frame_pool().allocate(size);
+    }
+
+    void TaskFramePool::deallocate(void* const pointer, std::size_t const size) noexcept
+    {
+        if (size > FramePool::max_size)
+            ::operator delete(pointer, size);
+        else
+            frame_pool().deallocate(pointer, size);
+    }
+}
+
+namespace Coli::Generic
+{
+    /* Task */
+
+    std::coroutine_handle<> Task::FinalAwaiter::await_suspend(handle_type const handle) noexcept
+    {
+        auto& promise = handle.promise();
+
+        if (promise.myContinuation)
+            return promise.myContinuation;
+
+        if (promise.myScheduler)
+            promise.myScheduler->finish(handle);
+
+        return std::noop_coroutine();
+    }
+
+    std::coroutine_handle<> Task::TaskAwaiter::await_suspend(handle_type const awaiting) noexcept
+    {
+        auto& promise = myHandle.promise();
+
+        promise.myContinuation = awaiting;
+        promise.myScheduler = awaiting.promise().myScheduler;
+
+        return myHandle;
+    }
+
+    void Task::TaskAwaiter::await_resume() const
+    {
+        if (myHandle && myHandle.promise().myError)
+            std::rethrow_exception(myHandle.promise().myError);
+    }
+
+    void Task::FramesAwaiter::await_suspend(handle_type const awaiting) const {
+        awaiting.promise().myScheduler->wait_frames(awaiting, myCount);
+    }
+
+    void Task::DelayAwaiter::await_suspend(handle_type const awaiting) const {
+        awaiting.promise().myScheduler->wait_time(awaiting, myDelay);
+    }
+
+    Task::Task() noexcept = default;
+
+    Task::Task(handle_type const handle) noexcept :
+        myHandle (handle)
+    {}
+
+    Task::Task(Task&& other) noexcept :
+        myHandle (std::exchange(other.myHandle, nullptr))
+    {}
+
+    Task& Task::operator=(Task&& other) noexcept
+    {
+        if (this != std::addressof(other)) {
+            if (myHandle)
+                myHandle.destroy();
+
+            myHandle = std::exchange(other.myHandle, nullptr);
+        }
+
+        return *this;
+    }
+
+    Task::~Task() noexcept
+    {
+        if (myHandle)
+            myHandle.destroy();
+    }
+
+    bool Task::done() const noexcept {
+        return !myHandle || myHandle.done();
+    }
+
+    Task::TaskAwaiter Task::operator co_await() && noexcept {
+        return TaskAwaiter { myHandle };
+    }
+
+    Task::FramesAwaiter Task::next_frame() noexcept {
+        return FramesAwaiter { 1 };
+    }
+
+    Task::FramesAwaiter Task::frames(std::uint64_t const count) noexcept {
+        return FramesAwaiter { count };
+    }
+
+    Task::DelayAwaiter Task::delay(std::chrono::nanoseconds const delay) noexcept {
+        return DelayAwaiter { delay };
+    }
+
+    /* TaskScheduler */
+
+    bool TaskScheduler::Waiter::operator>(Waiter const& other) const noexcept {
+        return due != other.due ? due > other.due : order > other.order;
+    }
+
+    TaskScheduler::TaskScheduler() noexcept :
+        myFrame (0),
+        myTime  (0),
+        myOrder (0)
+    {}
+
+    TaskScheduler::~TaskScheduler() noexcept
+    {
+        myFrameWaiters.clear();
+        myTimeWaiters.clear();
+
+        for (auto const root : myRoots)
+            root.destroy();
+
+        myRoots.clear();
+    }
+
+    void TaskScheduler::fail_empty_task() {
+        throw std::invalid_argument("The task is empty or has already started");
+    }
+
+    void TaskScheduler::push(std::vector<Waiter>& waiters, std::int64_t const due, std::coroutine_handle<> const handle)
+    {
+        waiters.push_back({ due, myOrder++, handle });
+        std::ranges::push_heap(waiters, std::greater{});
+    }
+
+    void TaskScheduler::pop_due(std::vector<Waiter>& waiters, std::int64_t const now)
+    {
+        while (!waiters.empty() && waiters.front().due <= now) {
+            std::ranges::pop_heap(waiters, std::greater{});
+            myReady.push_back(waiters.back().handle);
+            waiters.pop_back();
+        }
+    }
+
+    void TaskScheduler::destroy_root(Task::handle_type const handle) noexcept
+    {
+        auto const index = handle.promise().myRoot;
+
+        myRoots[index] = myRoots.back();
+        myRoots[index].promise().myRoot = index;
+        myRoots.pop_back();
+
+        handle.destroy();
+    }
+
+    void TaskScheduler::wait_frames(std::coroutine_handle<> const handle, std::uint64_t const count) {
+        push(myFrameWaiters, myFrame + static_cast<std::int64_t>(count), handle);
+    }
+
+    void TaskScheduler::wait_time(std::coroutine_handle<> const handle, std::chrono::nanoseconds const delay) {
+        push(myTimeWaiters, myTime + delay.count(), handle);
+    }
+
+    void TaskScheduler::finish(Task::handle_type const handle) noexcept {
+        myFinished.push_back(handle);
+    }
+
+    void TaskScheduler::start(Task task)
+    {
+        auto const handle = task.myHandle;
+
+        if (!handle || handle.promise().myScheduler)
+            fail_empty_task();
+
+        myRoots.reserve(myRoots.size() + 1);
+        myFinished.reserve(myRoots.size() + 1);
+
+        push(myFrameWaiters, myFrame + 1, handle);
+
+        handle.promise().myScheduler = this;
+        handle.promise().myRoot = myRoots.size();
+
+        myRoots.push_back(std::exchange(task.myHandle, nullptr));
+    }
+
+    void TaskScheduler::update(std::chrono::nanoseconds const delta)
+    {
+        ++myFrame;
+        myTime += delta.count();
+
+        myReady.clear();
+
+        pop_due(myFrameWaiters, myFrame);
+        pop_due(myTimeWaiters, myTime);
+
+        for (auto const handle : myReady)
+            handle.resume();
+
+        std::exception_ptr error;
+
+        for (auto const handle : myFinished)
+        {
+            if (!error)
+                error = handle.promise().myError;
+
+            destroy_root(handle);
+        }
+
+        myFinished.clear();
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    std::size_t TaskScheduler::size() const noexcept {
+        return myRoots.size();
+    }
+
+    std::chrono::nanoseconds TaskScheduler::time() const noexcept {
+        return std::chrono::nanoseconds(myTime);
+    }
+}
@@ -0,0 +1,118 @@
+#include "coli/generic/time_to_live_system.h"
+#include "coli/generic/shard.h"
+
+namespace Coli::Generic
+{
+    namespace
+    {
+        [[nodiscard]] std::uint64_t to_ticks(Types::float_type const seconds, Types::float_type const tick) noexcept
+        {
+            constexpr auto max_ticks = static_cast<Types::float_type>(std::numeric_limits<std::uint32_t>::max());
+            return static_cast<std::uint64_t>(std::clamp<Types::float_type>(std::ceil(seconds / tick), 0, max_ticks));
+        }
+    }
+
+    /* TimeToLiveSystem */
+
+    void TimeToLiveSystem::fail_invalid_tick() {
+        throw std::invalid_argument("The tick must be positive");
+    }
+
+    TimeToLiveSystem::TimeToLiveSystem() noexcept :
+        myTick  (std::chrono::duration<Types::float_type> { Shard::default_step }.count()),
+        myTicks (0)
+    {}
+
+    TimeToLiveSystem::TimeToLiveSystem(std::chrono::nanoseconds const tick) :
+        myTick  (std::chrono::duration<Types::float_type> { tick }.count()),
+        myTicks (0)
+    {
+        if (tick <= std::chrono::nanoseconds::zero())
+            fail_invalid_tick();
+    }
+
+    TimeToLiveSystem::TimeToLiveSystem(TimeToLiveSystem const& other) noexcept :
+        Detail::SystemBase (other),
+        myTick             (other.myTick),
+        myTicks            (0)
+    {}
+
+    TimeToLiveSystem::TimeToLiveSystem(TimeToLiveSystem&&) noexcept = default;
+
+    TimeToLiveSystem& TimeToLiveSystem::operator=(TimeToLiveSystem const& other) noexcept
+    {
+        Detail::SystemBase::operator=(other);
+
+        myObserver.reset();
+        myWheel.clear();
+        myTick = other.myTick;
+        myTicks = 0;
+
+        return *this;
+    }
+
+    TimeToLiveSystem& TimeToLiveSystem::operator=(TimeToLiveSystem&&) noexcept = default;
+
+    TimeToLiveSystem::~TimeToLiveSystem() noexcept = default;
+
+    TimerWheel const& TimeToLiveSystem::wheel() const noexcept {
+        return myWheel;
+    }
+
+    SystemAccess TimeToLiveSystem::access() const {
+        return Detail::Signature<component_type const>::access();
+    }
+
+    void TimeToLiveSystem::prepare(Game::Scene& scene, Frame const& frame)
+    {
+        auto const slots = frame.workers().slot_count();
+
+        Detail::Signature<component_type const>::prepare(scene);
+
+        if (!myObserver || !myObserver->observes(scene))
+        {
+            myObserver.reset();
+            myWheel.clear();
+            myObserver = std::make_unique<observer_type>(scene, slots);
+        }
+        else if (myObserver->slot_count() != slots)
+            myObserver->resize(slots);
+    }
+
+    void TimeToLiveSystem::execute(Game::Scene& scene, Frame const& frame)
+    {
+        auto const objects = scene.filtered<component_type const>();
+
+        myObserver->collect();
+
+        for (auto const entity : myObserver->changed())
+            if (objects.contains(entity))
+                myWheel.schedule(entity, to_ticks(objects.get<component_type const>(entity).seconds(), myTick));
+
+        myObserver->clear();
+
+        // The execution covers all the simulated time since the previous one,
+        // e.g. the frames skipped by the run policy, and the rest of a tick
+        // is carried over to the next execution.
+        myTicks += elapsed() / myTick;
+
+        auto const ticks = std::floor(myTicks);
+        myTicks -= ticks;
+
+        auto& commands = frame.commands();
+        std::size_t count = 0;
+
+        for (auto i = static_cast<std::uint64_t>(ticks); i > 0; --i)
+        {
+            myWheel.advance();
+
+            for (auto const entity : myWheel.fired())
+                if (objects.contains(entity)) {
+                    commands.destroy(entity);
+                    ++count;
+                }
+        }
+
+        count_processed(count);
+    }
+}
@@ -0,0 +1,304 @@
+#include "coli/generic/timer_wheel.h"
+#include "coli/generic/worker_pool.h"
+
+namespace Coli::Generic
+{
+    namespace
+    {
+        constexpr std::uint32_t no_node = std::numeric_limits<std::uint32_t>::max();
+
+        [[nodiscard]] constexpr std::uint64_t level_span(std::size_t const level) noexcept {
+            return std::uint64_t { 1 } << (TimerWheel::level_bits * level);
+        }
+    }
+
+    /* TimerWheel */
+
+    TimerWheel::TimerWheel() noexcept :
+        myNow  (0),
+        mySize (0)
+    {
+        myBuckets.fill(no_node);
+    }
+
+    TimerWheel::TimerWheel(TimerWheel const&) = default;
+
+    TimerWheel::TimerWheel(TimerWheel&& other) noexcept :
+        myNodes   (std::move(other.myNodes)),
+        myFired   (std::move(other.myFired)),
+        myBuckets (other.myBuckets),
+        myNow     (other.myNow),
+        mySize    (std::exchange(other.mySize, 0))
+    {
+        other.clear();
+    }
+
+    TimerWheel& TimerWheel::operator=(TimerWheel const&) = default;
+
+    TimerWheel& TimerWheel::operator=(TimerWheel&& other) noexcept
+    {
+        myNodes = std::move(other.myNodes);
+        myFired = std::move(other.myFired);
+        myBuckets = other.myBuckets;
+        myNow = other.myNow;
+        mySize = std::exchange(other.mySize, 0);
+
+        other.clear();
+        return *this;
+    }
+
+    TimerWheel::~TimerWheel() noexcept = default;
+
+    void TimerWheel::insert(std::uint32_t const index) noexcept
+    {
+        auto& node = myNodes[index];
+        auto const delta = node.deadline - myNow;
+
+        std::size_t level = 0;
+
+        while (level + 1 < levels && delta >= level_span(level + 1))
+            ++level;
+
+        // The timers beyond the last level wait in its farthest bucket
+        // and are placed again when it is cascaded.
+        auto const position = std::min(node.deadline, myNow + level_span(levels) - 1);
+        auto const bucket = level * level_size + ((position >> (level_bits * level)) & (level_size - 1));
+
+        node.bucket = static_cast<std::uint32_t>(bucket);
+        node.previous = no_node;
+        node.next = myBuckets[bucket];
+
+        if (node.next != no_node)
+            myNodes[node.next].previous = index;
+
+        myBuckets[bucket] = index;
+    }
+
+    void TimerWheel::unlink(std::uint32_t const index) noexcept
+    {
+        auto& node = myNodes[index];
+
+        if (node.previous != no_node)
+            myNodes[node.previous].next = node.next;
+        else
+            myBuckets[node.bucket] = node.next;
+
+        if (node.next != no_node)
+            myNodes[node.next].previous = node.previous;
+
+        node.bucket = no_node;
+    }
+
+    void TimerWheel::cascade(std::size_t const level) noexcept
+    {
+        auto const bucket = level * level_size + ((myNow >> (level_bits * level)) & (level_size - 1));
+        auto index = std::exchange(myBuckets[bucket], no_node);
+
+        while (index != no_node) {
+            auto const next = myNodes[index].next;
+            insert(index);
+            index = next;
+        }
+    }
+
+    void TimerWheel::schedule(entt::entity const entity, std::uint64_t const ticks)
+    {
+        auto const index = static_cast<std::uint32_t>(entt::to_entity(entity));
+
+        if (index >= myNodes.size())
+            myNodes.resize(index + 1);
+
+        auto& node = myNodes[index];
+
+        if (node.bucket != no_node)
+            unlink(index);
+        else
+            ++mySize;
+
+        node.entity = entity;
+        node.deadline = myNow + std::clamp<std::uint64_t>(ticks, 1, std::numeric_limits<std::uint64_t>::max() - myNow);
+
+        insert(index);
+    }
+
+    bool TimerWheel::cancel(entt::entity const entity) noexcept
+    {
+        if (!scheduled(entity))
+            return false;
+
+        unlink(static_cast<std::uint32_t>(entt::to_entity(entity)));
+        --mySize;
+
+        return true;
+    }
+
+    bool TimerWheel::scheduled(entt::entity const entity) const noexcept
+    {
+        auto const index = static_cast<std::size_t>(entt::to_entity(entity));
+
+        return index < myNodes.size()
+            && myNodes[index].bucket != no_node
+            && myNodes[index].entity == entity;
+    }
+
+    std::uint64_t TimerWheel::remaining(entt::entity const entity) const noexcept
+    {
+        if (!scheduled(entity))
+            return 0;
+
+        return myNodes[entt::to_entity(entity)].deadline - myNow;
+    }
+
+    void TimerWheel::advance()
+    {
+        myFired.clear();
+        ++myNow;
+
+        std::size_t top = 0;
+
+        while (top + 1 < levels && myNow % level_span(top + 1) == 0)
+            ++top;
+
+        for (auto level = top; level > 0; --level)
+            cascade(level);
+
+        auto index = std::exchange(myBuckets[myNow & (level_size - 1)], no_node);
+
+        while (index != no_node)
+        {
+            auto& node = myNodes[index];
+            auto const next = node.next;
+
+            if (node.deadline <= myNow) {
+                node.bucket = no_node;
+                --mySize;
+
+                myFired.push_back(node.entity);
+            }
+            else
+                insert(index);
+
+            index = next;
+        }
+    }
+
+    std::span<entt::entity const> TimerWheel::fired() const noexcept {
+        return myFired;
+    }
+
+    std::uint64_t TimerWheel::now() const noexcept {
+        return myNow;
+    }
+
+    std::size_t TimerWheel::size() const noexcept {
+        return mySize;
+    }
+
+    bool TimerWheel::empty() const noexcept {
+        return mySize == 0;
+    }
+
+    void TimerWheel::clear() noexcept
+    {
+        myNodes.clear();
+        myFired.clear();
+        myBuckets.fill(no_node);
+        mySize = 0;
+    }
+
+    /* FrameTimers */
+
+    FrameTimers::FrameTimers(std::size_t const slots) :
+        mySlots      (std::make_unique<Slot[]>(std::max<std::size_t>(slots, 1))),
+        mySize       (std::max<std::size_t>(slots, 1)),
+        myIsAdvanced (false)
+    {}
+
+    FrameTimers::FrameTimers(FrameTimers&& other) noexcept :
+        myWheel      (std::move(other.myWheel)),
+        mySlots      (std::move(other.mySlots)),
+        mySize       (std::exchange(other.mySize, 0)),
+        myIsAdvanced (std::exchange(other.myIsAdvanced, false))
+    {}
+
+    FrameTimers& FrameTimers::operator=(FrameTimers&& other) noexcept
+    {
+        myWheel = std::move(other.myWheel);
+        mySlots = std::move(other.mySlots);
+        mySize = std::exchange(other.mySize, 0);
+        myIsAdvanced = std::exchange(other.myIsAdvanced, false);
+
+        return *this;
+    }
+
+    FrameTimers::~FrameTimers() noexcept = default;
+
+    void FrameTimers::schedule(entt::entity const entity, std::uint64_t const ticks)
+    {
+        mySlots[WorkerPool::current_slot(mySize)].requests.push_back(
+            Request { entity, std::min(ticks, cancel_ticks - 1) });
+    }
+
+    void FrameTimers::cancel(entt::entity const entity) {
+        mySlots[WorkerPool::current_slot(mySize)].requests.push_back(Request { entity, cancel_ticks });
+    }
+
+    std::span<entt::entity const> FrameTimers::fired() const noexcept
+    {
+        if (myIsAdvanced)
+            return myWheel.fired();
+
+        return {};
+    }
+
+    TimerWheel& FrameTimers::wheel() noexcept {
+        return myWheel;
+    }
+
+    TimerWheel const& FrameTimers::wheel() const noexcept {
+        return myWheel;
+    }
+
+    std::size_t FrameTimers::size() const noexcept {
+        return mySize;
+    }
+
+    void FrameTimers::resize(std::size_t const slots)
+    {
+        mySlots = std::make_unique<Slot[]>(std::max<std::size_t>(slots, 1));
+        mySize = std::max<std::size_t>(slots, 1);
+    }
+
+    void FrameTimers::advance()
+    {
+        myWheel.advance();
+        myIsAdvanced = true;
+    }
+
+    void FrameTimers::flush()
+    {
+        struct Guard
+        {
+            ~Guard() noexcept
+            {
+                for (std::size_t i = 0; i < size; ++i)
+                    slots[i].requests.clear();
+            }
+
+            Slot* slots;
+            std::size_t size;
+        }
+        const guard { mySlots.get(), mySize };
+
+        myIsAdvanced = false;
+
+        for (std::size_t i = 0; i < mySize; ++i)
+            for (auto const& [entity, ticks] : mySlots[i].requests)
+            {
+                if (ticks == cancel_ticks)
+                    myWheel.cancel(entity);
+                else
+                    myWheel.schedule(entity, ticks);
+            }
+    }
+}
@@ -0,0 +1,344 @@
+#include "coli/generic/worker_pool.h"
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#elif defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#endif
+
+namespace Coli::Generic
+{
+    namespace
+    {
+        thread_local WorkerPool const* ourPool = nullptr;
+        thread_local std::size_t ourSlot = 0;
+        thread_local JobCounter* ourCounter = nullptr;
+    }
+
+    /* JobCounter */
+
+    JobCounter::JobCounter() noexcept :
+        myValue (0)
+    {}
+
+    JobCounter::~JobCounter() noexcept = default;
+
+    std::size_t JobCounter::value() const noexcept {
+        return myValue.load(std::memory_order_acquire);
+    }
+
+    bool JobCounter::done() const noexcept {
+        return value() == 0;
+    }
+
+    /* WorkerPool */
+
+    void WorkerPool::fail_slot_out_of_range() {
+        throw std::out_of_range("The thread slot is out of the slots range");
+    }
+
+    WorkerPool::WorkerPool(std::size_t workers, bool const pin) :
+        myQueues     (std::make_unique<Queue[]>(workers + 1)),
+        mySlotCount  (workers + 1),
+        myQueued     (0),
+        mySleeping   (0),
+        myIsStopping (false)
+    {
+        myThreads.reserve(workers);
+
+        try {
+            for (std::size_t slot = 1; slot <= workers; ++slot) {
+                myThreads.emplace_back(&WorkerPool::work, this, slot);
+
+                if (pin)
+                    this->pin(slot);
+            }
+        }
+        catch (...) {
+            shutdown();
+            throw;
+        }
+    }
+
+    WorkerPool::~WorkerPool() noexcept {
+        shutdown();
+    }
+
+    void WorkerPool::shutdown() noexcept
+    {
+        {
+            std::lock_guard lock { mySleepMutex };
+            myIsStopping.store(true);
+        }
+
+        myWakeup.notify_all();
+
+        for (auto& thread : myThreads)
+            if (thread.joinable())
+                thread.join();
+
+        myThreads.clear();
+
+        while (run_pending())
+            ;
+    }
+
+    void WorkerPool::pin(std::size_t const slot) noexcept
+    {
+        auto const cpus = std::max(std::thread::hardware_concurrency(), 1u);
+        auto const cpu = slot % cpus;
+        auto& thread = myThreads[slot - 1];
+
+#if defined(__linux__)
+        cpu_set_t set;
+
+        CPU_ZERO(&set);
+        CPU_SET(cpu % CPU_SETSIZE, &set);
+
+        static_cast<void>(pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set));
+#elif defined(_WIN32)
+        auto const mask = DWORD_PTR(1) << (cpu % (sizeof(DWORD_PTR) * 8));
+
+        static_cast<void>(SetThreadAffinityMask(thread.native_handle(), mask));
+#else
+        static_cast<void>(cpu);
+        static_cast<void>(thread);
+#endif
+    }
+
+    std::size_t WorkerPool::worker_count() const noexcept {
+        return myThreads.size();
+    }
+
+    std::size_t WorkerPool::slot_count() const noexcept {
+        return mySlotCount;
+    }
+
+    std::size_t WorkerPool::current_slot() noexcept {
+        return ourSlot;
+    }
+
+    std::size_t WorkerPool::current_slot(std::size_t const count)
+    {
+        if (ourSlot >= count)
+            fail_slot_out_of_range();
+
+        return ourSlot;
+    }
+
+    void WorkerPool::submit(job_type job) {
+        push({ std::move(job), nullptr });
+    }
+
+    void WorkerPool::submit(job_type job, JobCounter& counter)
+    {
+        counter.myValue.fetch_add(1, std::memory_order_relaxed);
+
+        try {
+            push({ std::move(job), std::addressof(counter) });
+        }
+        catch (...) {
+            counter.myValue.fetch_sub(1, std::memory_order_release);
+            throw;
+        }
+    }
+
+    void WorkerPool::submit_child(job_type job)
+    {
+        if (ourCounter)
+            submit(std::move(job), *ourCounter);
+        else
+            submit(std::move(job));
+    }
+
+    void WorkerPool::push(Job job)
+    {
+        auto const slot = ourPool == this ? ourSlot : 0;
+
+        {
+            std::lock_guard lock { myQueues[slot].mutex };
+
+            myQueues[slot].jobs.push_back(std::move(job));
+            myQueued.fetch_add(1);
+        }
+
+        if (mySleeping.load() != 0) {
+            { std::lock_guard lock { mySleepMutex }; }
+            myWakeup.notify_one();
+        }
+    }
+
+    void WorkerPool::execute(Job& job) noexcept
+    {
+        auto* const parent = std::exchange(ourCounter, job.counter);
+
+        job.function();
+        ourCounter = parent;
+
+        if (job.counter)
+            job.counter->myValue.fetch_sub(1, std::memory_order_release);
+    }
+
+    bool WorkerPool::take(std::size_t slot, Job& job)
+    {
+        if (myQueued.load(std::memory_order_relaxed) == 0)
+            return false;
+
+        {
+            auto& own = myQueues[slot];
+            std::lock_guard lock { own.mutex };
+
+            if (!own.jobs.empty()) {
+                job = std::move(own.jobs.back());
+                own.jobs.pop_back();
+                myQueued.fetch_sub(1, std::memory_order_relaxed);
+
+                return true;
+            }
+        }
+
+        for (std::size_t offset = 1; offset < mySlotCount; ++offset)
+        {
+            auto& victim = myQueues[(slot + offset) % mySlotCount];
+            std::lock_guard lock { victim.mutex };
+
+            if (!victim.jobs.empty()) {
+                job = std::move(victim.jobs.front());
+                victim.jobs.pop_front();
+                myQueued.fetch_sub(1, std::memory_order_relaxed);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool WorkerPool::run_pending()
+    {
+        Job job;
+
+        if (!take(ourPool == this ? ourSlot : 0, job))
+            return false;
+
+        execute(job);
+        return true;
+    }
+
+    void WorkerPool::wait(std::atomic<std::size_t> const& counter)
+    {
+        while (counter.load(std::memory_order_acquire) != 0)
+            if (!run_pending())
+                std::this_thread::yield();
+    }
+
+    void WorkerPool::wait(JobCounter const& counter) {
+        wait(counter.myValue);
+    }
+
+    void WorkerPool::dispatch(
+        std::size_t const first,
+        std::size_t const last,
+        std::size_t grain,
+        chunk_function const function,
+        void* const context)
+    {
+        if (first >= last)
+            return;
+
+        grain = std::max<std::size_t>(grain, 1);
+
+        auto const chunks = (last - first + grain - 1) / grain;
+        auto const runners = std::min(chunks, mySlotCount);
+
+        if (runners == 1) {
+            function(context, first, last);
+            return;
+        }
+
+        struct State
+        {
+            std::atomic<std::size_t> next;
+            std::atomic<std::size_t> pending;
+
+            std::mutex errorMutex;
+            std::exception_ptr error;
+        }
+        state { 0, runners - 1, {}, nullptr };
+
+        auto const run = [&] () noexcept
+        {
+            for (auto chunk = state.next.fetch_add(1, std::memory_order_relaxed);
+                 chunk < chunks;
+                 chunk = state.next.fetch_add(1, std::memory_order_relaxed))
+            {
+                auto const begin = first + chunk * grain;
+                auto const end = std::min(last, begin + grain);
+
+                try {
+                    function(context, begin, end);
+                }
+                catch (...) {
+                    std::lock_guard lock { state.errorMutex };
+
+                    if (!state.error)
+                        state.error = std::current_exception();
+
+                    state.next.store(chunks, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        for (std::size_t i = 1; i < runners; ++i)
+        {
+            try {
+                submit([&run, &state] {
+                    run();
+                    state.pending.fetch_sub(1, std::memory_order_release);
+                });
+            }
+            catch (...) {
+                state.pending.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        run();
+        wait(state.pending);
+
+        if (state.error)
+            std::rethrow_exception(state.error);
+    }
+
+    void WorkerPool::work(std::size_t const slot) noexcept
+    {
+        ourPool = this;
+        ourSlot = slot;
+
+        Job job;
+
+        while (true)
+        {
+            if (take(slot, job)) {
+                execute(job);
+                job.function = nullptr;
+
+                continue;
+            }
+
+            std::unique_lock lock { mySleepMutex };
+            mySleeping.fetch_add(1);
+
+            myWakeup.wait(lock, [this] {
+                return myIsStopping.load() || myQueued.load() != 0;
+            });
+
+            mySleeping.fetch_sub(1);
+
+            if (myIsStopping.load() && myQueued.load() == 0)
+                return;
+        }
+    }
+}
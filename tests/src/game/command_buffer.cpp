@@ -0,0 +1,172 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Position { int value = 0; };
+    struct Velocity { int value = 0; };
+}
+
+class CommandBufferTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_unique<Game::Scene>();
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        scene.reset();
+    }
+
+    std::unique_ptr<Game::Scene> scene;
+};
+
+/* Record */
+
+TEST_F(CommandBufferTest, Unbound)
+{
+    Game::CommandBuffer buffer;
+
+    EXPECT_THROW(static_cast<void>(buffer.create()), std::logic_error);
+    EXPECT_THROW(buffer.flush(), std::logic_error);
+}
+
+TEST_F(CommandBufferTest, CreateReserved)
+{
+    Game::CommandBuffer buffer { *scene };
+
+    auto const first = buffer.create();
+    auto const second = buffer.create();
+
+    EXPECT_NE(first, second);
+
+    buffer.emplace<Position>(first, 1);
+    buffer.emplace<Position>(second, 2);
+    buffer.emplace<Velocity>(second, 3);
+
+    EXPECT_FALSE(buffer.empty());
+    EXPECT_EQ(scene->filtered<Position>().size_hint(), 0u);
+
+    buffer.flush();
+
+    EXPECT_TRUE(buffer.empty());
+
+    auto const positions = scene->filtered<Position const>();
+
+    ASSERT_TRUE(positions.contains(first));
+    ASSERT_TRUE(positions.contains(second));
+    EXPECT_EQ(positions.get<Position const>(first).value, 1);
+    EXPECT_EQ(positions.get<Position const>(second).value, 2);
+    EXPECT_TRUE(scene->filtered<Velocity const>().contains(second));
+}
+
+TEST_F(CommandBufferTest, ReservedAfterCreate)
+{
+    auto const created = scene->create();
+    auto const reserved = scene->reserve();
+
+    auto const other = scene->create();
+
+    EXPECT_NE(other.entity(), reserved);
+    EXPECT_NE(created.entity(), reserved);
+
+    Game::CommandBuffer buffer { *scene };
+
+    buffer.emplace<Position>(reserved, 4);
+    buffer.flush();
+
+    EXPECT_EQ(scene->filtered<Position const>().get<Position const>(reserved).value, 4);
+}
+
+TEST_F(CommandBufferTest, Order)
+{
+    auto object = scene->create();
+    Game::CommandBuffer buffer { *scene };
+
+    buffer.emplace<Position>(object.entity(), 1);
+    buffer.remove<Position>(object.entity());
+    buffer.emplace<Velocity>(object.entity(), 2);
+    buffer.emplace<Velocity>(object.entity(), 3);
+    buffer.flush();
+
+    EXPECT_FALSE(object.contains<Position>());
+    EXPECT_EQ(object.get<Velocity>().value, 3);
+}
+
+TEST_F(CommandBufferTest, Destroy)
+{
+    auto object = scene->create();
+    Game::CommandBuffer buffer { *scene };
+
+    buffer.emplace<Position>(object.entity(), 1);
+    buffer.destroy(object);
+    buffer.destroy(object);
+
+    ASSERT_FALSE(object.expired());
+
+    buffer.flush();
+
+    EXPECT_TRUE(object.expired());
+    EXPECT_EQ(scene->filtered<Position>().size_hint(), 0u);
+}
+
+TEST_F(CommandBufferTest, Clear)
+{
+    auto object = scene->create();
+    Game::CommandBuffer buffer { *scene };
+
+    buffer.emplace<Position>(object.entity(), 1);
+    buffer.destroy(object);
+    buffer.clear();
+
+    EXPECT_TRUE(buffer.empty());
+
+    buffer.flush();
+
+    EXPECT_FALSE(object.expired());
+    EXPECT_FALSE(object.contains<Position>());
+}
+
+/* Frame commands */
+
+TEST_F(CommandBufferTest, ParallelRecording)
+{
+    constexpr std::size_t count = 10'000;
+
+    Generic::WorkerPool workers { 3 };
+    Generic::FrameCommands commands { workers.slot_count() };
+
+    commands.bind(*scene);
+
+    workers.parallel_for(0, count, 64, [&] (std::size_t const first, std::size_t const last)
+    {
+        auto& buffer = commands.local();
+
+        for (auto i = first; i < last; ++i)
+            buffer.emplace<Position>(buffer.create(), static_cast<int>(i));
+    });
+
+    commands.flush(*scene);
+
+    std::vector<bool> seen(count);
+
+    scene->filtered<Position const>().each([&] (Position const& position) {
+        seen[static_cast<std::size_t>(position.value)] = true;
+    });
+
+    EXPECT_TRUE(std::ranges::all_of(seen, std::identity{}));
+
+    for (std::size_t i = 0; i < commands.size(); ++i)
+        EXPECT_TRUE(commands[i].empty());
+}
@@ -0,0 +1,204 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Cell { int value = 0; };
+
+    using BufferedCell = Game::Components::DoubleBuffered<Cell>;
+
+    class StepSystem final :
+        public Generic::ParallelSystemBase<BufferedCell>
+    {
+    public:
+        [[nodiscard]] std::size_t chunk_size() const noexcept override {
+            return 64;
+        }
+
+        void process(BufferedCell& cell) override {
+            cell.back().value = cell.front().value + 1;
+        }
+
+        void update() override {}
+    };
+
+    class ReadSystem final :
+        public Generic::SystemBase<BufferedCell const>
+    {
+    public:
+        void process(BufferedCell const& cell) override {
+            sum += cell.front().value;
+        }
+
+        void update() override
+        {
+            sums.push_back(sum);
+            sum = 0;
+        }
+
+        int sum = 0;
+        std::vector<int> sums;
+    };
+}
+
+class DoubleBufferedTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_shared<Game::Scene>();
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        scene.reset();
+    }
+
+    std::shared_ptr<Game::Scene> scene;
+};
+
+/* Buffers */
+
+TEST_F(DoubleBufferedTest, Swap)
+{
+    auto object = scene->create();
+    object.emplace<BufferedCell>(Cell { 1 });
+
+    auto& state = scene->buffer<Cell>();
+    auto& cell = object.get<BufferedCell>();
+
+    cell.back().value = 2;
+
+    EXPECT_EQ(cell.front().value, 1);
+
+    scene->swap_buffers();
+
+    EXPECT_EQ(cell.front().value, 1);
+
+    state.written();
+    scene->swap_buffers();
+
+    EXPECT_EQ(cell.front().value, 2);
+    EXPECT_EQ(cell.back().value, 1);
+}
+
+TEST_F(DoubleBufferedTest, BoundLater)
+{
+    auto object = scene->create();
+    object.emplace<BufferedCell>(Cell { 1 });
+
+    scene->buffer<Cell>().written();
+    scene->swap_buffers();
+
+    auto other = scene->create();
+    other.emplace<BufferedCell>(Cell { 3 });
+
+    other.get<BufferedCell>().back().value = 4;
+    object.get<BufferedCell>().back().value = 2;
+
+    scene->buffer<Cell>().written();
+    scene->swap_buffers();
+
+    EXPECT_EQ(object.get<BufferedCell>().front().value, 2);
+    EXPECT_EQ(other.get<BufferedCell>().front().value, 4);
+}
+
+/* Systems */
+
+TEST_F(DoubleBufferedTest, Access)
+{
+    auto const step = StepSystem {}.access();
+    auto const read = ReadSystem {}.access();
+
+    EXPECT_FALSE(step.conflicts(read));
+    EXPECT_TRUE(step.conflicts(StepSystem {}.access()));
+}
+
+TEST_F(DoubleBufferedTest, Engine)
+{
+    for (int i = 0; i < 1000; ++i)
+        scene->create().emplace<BufferedCell>();
+
+    Generic::Engine engine;
+
+    Generic::Engine::WorkerSettings settings;
+    settings.count = 2;
+
+    engine.worker_settings(settings);
+    engine.active_scene(scene);
+
+    ASSERT_NO_THROW(engine.make_system<StepSystem>());
+    auto const read = engine.make_system<ReadSystem>().lock();
+
+    engine.run_frames(4);
+
+    ASSERT_EQ(read->sums.size(), 4u);
+
+    for (int frame = 0; frame < 4; ++frame)
+        EXPECT_EQ(read->sums[frame], frame * 1000);
+
+    scene->filtered<BufferedCell const>().each([] (BufferedCell const& cell) {
+        EXPECT_EQ(cell.front().value, 4);
+    });
+}
+
+TEST_F(DoubleBufferedTest, ReplaceThenSwap)
+{
+    auto object = scene->create();
+    object.emplace<BufferedCell>(Cell { 1 });
+
+    auto& state = scene->buffer<Cell>();
+
+    state.written();
+    scene->swap_buffers();
+
+    object.emplace<BufferedCell>(Cell { 5 });
+    object.get<BufferedCell>().back().value = 6;
+
+    EXPECT_EQ(object.get<BufferedCell>().front().value, 5);
+
+    state.written();
+    scene->swap_buffers();
+
+    EXPECT_EQ(object.get<BufferedCell>().front().value, 6);
+    EXPECT_EQ(object.get<BufferedCell>().back().value, 5);
+
+    object.get<BufferedCell>().back().value = 7;
+
+    state.written();
+    scene->swap_buffers();
+
+    EXPECT_EQ(object.get<BufferedCell>().front().value, 7);
+}
+
+TEST_F(DoubleBufferedTest, AccessOutlivesScene)
+{
+    auto object = scene->create();
+    object.emplace<BufferedCell>(Cell { 1 });
+
+    auto& state = scene->buffer<Cell>();
+
+    object.get<BufferedCell>().back().value = 2;
+
+    state.written();
+    scene->swap_buffers();
+
+    auto const access = std::make_unique<Game::SceneAccess>(*scene);
+    scene.reset();
+
+    EXPECT_EQ(access->get<BufferedCell>(object.entity()).front().value, 2);
+    EXPECT_EQ(access->get<BufferedCell>(object.entity()).back().value, 1);
+
+    object.emplace<BufferedCell>(Cell { 3 });
+
+    EXPECT_EQ(access->get<BufferedCell>(object.entity()).front().value, 3);
+}
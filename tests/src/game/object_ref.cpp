@@ -0,0 +1,171 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Health { int value = 10; };
+    struct Tag {};
+}
+
+class ObjectRefTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_unique<Game::Scene>();
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        scene.reset();
+    }
+
+    std::unique_ptr<Game::Scene> scene;
+};
+
+/* Reference */
+
+TEST_F(ObjectRefTest, Compact)
+{
+    EXPECT_EQ(sizeof(Game::ObjectRef), 8u);
+    EXPECT_TRUE(std::is_trivially_copyable_v<Game::ObjectRef>);
+    EXPECT_TRUE(Game::ObjectRef {}.expired());
+}
+
+TEST_F(ObjectRefTest, Access)
+{
+    auto const object = scene->create();
+    auto ref = scene->ref(object);
+
+    EXPECT_FALSE(ref.expired());
+    EXPECT_EQ(ref.scene(), scene->id());
+    EXPECT_EQ(ref.entity(), object.entity());
+
+    ref.emplace<Health>(5);
+    ref.emplace<Tag>();
+
+    EXPECT_EQ(ref.get<Health>().value, 5);
+    EXPECT_EQ(object.get<Health>().value, 5);
+    EXPECT_TRUE(ref.contains<Tag>());
+    EXPECT_EQ(ref.try_get<Tag const>(), object.try_get<Tag>());
+
+    ref.get<Health>().value = 7;
+
+    EXPECT_EQ(object.get<Health>().value, 7);
+}
+
+TEST_F(ObjectRefTest, Missing)
+{
+    auto ref = scene->ref(scene->create());
+
+    EXPECT_THROW(static_cast<void>(ref.get<Health>()), std::invalid_argument);
+    EXPECT_EQ(ref.try_get<Health>(), nullptr);
+    EXPECT_FALSE(ref.contains<Health>());
+}
+
+TEST_F(ObjectRefTest, DestroyedObject)
+{
+    auto const object = scene->create();
+    auto ref = scene->ref(object);
+
+    scene->destroy(object);
+
+    EXPECT_TRUE(ref.expired());
+    EXPECT_THROW(ref.emplace<Health>(), std::bad_weak_ptr);
+}
+
+TEST_F(ObjectRefTest, DestroyedScene)
+{
+    auto ref = scene->ref(scene->create());
+
+    scene.reset();
+
+    EXPECT_TRUE(ref.expired());
+    EXPECT_THROW(static_cast<void>(ref.get<Health>()), std::bad_weak_ptr);
+
+    auto const other = std::make_unique<Game::Scene>();
+    static_cast<void>(other->create());
+
+    EXPECT_NE(other->id(), ref.scene());
+    EXPECT_TRUE(ref.expired());
+}
+
+TEST_F(ObjectRefTest, MovedScene)
+{
+    auto const ref = scene->ref(scene->create());
+    auto const id = scene->id();
+
+    Game::Scene moved { std::move(*scene) };
+
+    EXPECT_EQ(moved.id(), id);
+    EXPECT_FALSE(ref.expired());
+}
+
+/* Scene access */
+
+TEST_F(ObjectRefTest, SceneAccess)
+{
+    std::vector<Game::ObjectRef> refs;
+
+    for (int i = 0; i < 100; ++i) {
+        auto object = scene->create();
+
+        if (i % 2 == 0)
+            object.emplace<Health>(i);
+
+        refs.push_back(scene->ref(object));
+    }
+
+    Game::SceneAccess access { refs.front() };
+    int total = 0;
+
+    for (auto const ref : refs)
+        if (auto const* const health = access.try_get<Health const>(ref.entity()))
+            total += health->value;
+
+    EXPECT_EQ(total, 2450);
+
+    for (auto const ref : refs)
+        if (access.contains<Health>(ref.entity()))
+            access.get<Health>(ref.entity()).value = 1;
+
+    EXPECT_EQ(refs[2].get<Health>().value, 1);
+}
+
+TEST_F(ObjectRefTest, SceneAccessExpired)
+{
+    auto const object = scene->create();
+    auto const ref = scene->ref(object);
+
+    {
+        Game::SceneAccess access { object };
+        scene.reset();
+
+        EXPECT_TRUE(access.valid(object.entity()));
+    }
+
+    EXPECT_TRUE(object.expired());
+    EXPECT_THROW(Game::SceneAccess { object }, std::bad_weak_ptr);
+    EXPECT_THROW(Game::SceneAccess { ref }, std::bad_weak_ptr);
+}
+
+TEST_F(ObjectRefTest, SceneAccessReset)
+{
+    auto object = scene->create();
+    object.emplace<Health>(3);
+
+    Game::SceneAccess access { *scene };
+    scene->reset();
+
+    EXPECT_TRUE(access.valid(object.entity()));
+    EXPECT_EQ(access.get<Health>(object.entity()).value, 3);
+}
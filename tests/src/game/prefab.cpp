@@ -0,0 +1,134 @@
+#include <coli/game-engine.h>
+#include <coli/game/components/transform.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Health { int value = 10; };
+    struct Name { std::string value; };
+}
+
+class PrefabTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_unique<Game::Scene>();
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        scene.reset();
+    }
+
+    std::unique_ptr<Game::Scene> scene;
+};
+
+/* Components */
+
+TEST_F(PrefabTest, Components)
+{
+    Game::Prefab prefab;
+
+    EXPECT_TRUE(prefab.empty());
+
+    prefab.emplace<Health>(5);
+    prefab.emplace<Game::Components::Layer>(2);
+    prefab.emplace<Health>(7);
+
+    EXPECT_EQ(prefab.size(), 2u);
+    EXPECT_EQ(prefab.get<Health>().value, 7);
+    EXPECT_TRUE(prefab.contains<Game::Components::Layer const>());
+    EXPECT_THROW(static_cast<void>(prefab.get<Name>()), std::invalid_argument);
+
+    prefab.destroy<Health>();
+
+    EXPECT_FALSE(prefab.contains<Health>());
+    EXPECT_EQ(prefab.size(), 1u);
+}
+
+TEST_F(PrefabTest, Copy)
+{
+    Game::Prefab prefab;
+    prefab.emplace<Name>("orc");
+
+    auto copy = prefab;
+    copy.get<Name>().value = "elf";
+
+    EXPECT_EQ(prefab.get<Name>().value, "orc");
+    EXPECT_EQ(copy.get<Name>().value, "elf");
+}
+
+TEST_F(PrefabTest, TriviallyCopyable)
+{
+    EXPECT_TRUE(std::is_trivially_copyable_v<Game::Components::Layer>);
+    EXPECT_TRUE(std::is_trivially_copyable_v<Game::Components::Transform3D>);
+    EXPECT_TRUE(std::is_trivially_copyable_v<Game::Components::Transform2D>);
+}
+
+/* Instantiation */
+
+TEST_F(PrefabTest, Instantiate)
+{
+    Game::Prefab prefab;
+    prefab.emplace<Health>(3);
+    prefab.emplace<Name>("orc");
+    prefab.emplace<Game::Components::Layer>(4);
+
+    static_cast<void>(scene->create());
+
+    auto const entities = prefab.instantiate(*scene, 100);
+
+    ASSERT_EQ(entities.size(), 100u);
+
+    for (auto const entity : entities)
+    {
+        auto const object = scene->handle(entity);
+
+        EXPECT_EQ(object.get<Health>().value, 3);
+        EXPECT_EQ(object.get<Name>().value, "orc");
+        EXPECT_EQ(object.get<Game::Components::Layer>().layer(), 4);
+    }
+
+    EXPECT_EQ(scene->filtered<Health>().size_hint(), 100u);
+    EXPECT_NE(scene->reserve(), entities.back());
+}
+
+TEST_F(PrefabTest, Override)
+{
+    Game::Prefab prefab;
+    prefab.emplace<Health>();
+    prefab.emplace<Game::Components::Layer>();
+    prefab.emplace<Game::Components::Transform3D>();
+
+    auto const entities = prefab.instantiate(*scene, 10,
+        [] (Game::SceneAccess& access, entt::entity const entity, std::size_t const index) {
+            access.get<Game::Components::Layer>(entity).layer(static_cast<long long>(index));
+        });
+
+    for (std::size_t i = 0; i < entities.size(); ++i)
+    {
+        auto const object = scene->handle(entities[i]);
+
+        EXPECT_EQ(object.get<Health>().value, 10);
+        EXPECT_EQ(object.get<Game::Components::Layer>().layer(), static_cast<long long>(i));
+        EXPECT_EQ(object.get<Game::Components::Transform3D>(), Game::Components::Transform3D {});
+    }
+}
+
+TEST_F(PrefabTest, Empty)
+{
+    Game::Prefab const prefab;
+
+    EXPECT_TRUE(prefab.instantiate(*scene, 0).empty());
+    EXPECT_EQ(prefab.instantiate(*scene, 3).size(), 3u);
+}
@@ -81,3 +81,232 @@ TEST_F(SceneTest, RemoveObject)
     ASSERT_NO_THROW(object = scene->create());
     EXPECT_FALSE(object.expired());
 }
+
+/* Bulk */
+
+namespace
+{
+    struct Position { int value = 0; };
+    struct Velocity { int value = 0; };
+}
+
+TEST_F(SceneTest, CreateMany)
+{
+    CREATE_SCENE;
+
+    auto const entities = scene->create_many(1000);
+
+    ASSERT_EQ(entities.size(), 1000u);
+
+    for (auto const entity : entities)
+        EXPECT_FALSE(scene->handle(entity).expired());
+
+    std::array<entt::entity, 16> more {};
+    scene->create_many(more);
+
+    EXPECT_TRUE(std::ranges::none_of(more, [&entities] (entt::entity const entity) {
+        return std::ranges::find(entities, entity) != entities.end();
+    }));
+
+    auto const reserved = scene->reserve();
+    static_cast<void>(scene->create());
+
+    EXPECT_FALSE(scene->handle(reserved).expired());
+    EXPECT_EQ(std::ranges::count(more, reserved), 0);
+}
+
+TEST_F(SceneTest, InsertMany)
+{
+    CREATE_SCENE;
+
+    scene->reserve<Position, Velocity>(100);
+
+    auto const entities = scene->create_many(100);
+    std::vector<Velocity> velocities(100);
+
+    for (std::size_t i = 0; i < velocities.size(); ++i)
+        velocities[i].value = static_cast<int>(i);
+
+    scene->insert<Position>(entities, Position { 7 });
+    scene->insert<Velocity>(entities, std::span<Velocity const> { velocities });
+
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+        auto const object = scene->handle(entities[i]);
+
+        EXPECT_EQ(object.get<Position>().value, 7);
+        EXPECT_EQ(object.get<Velocity>().value, static_cast<int>(i));
+    }
+
+    EXPECT_THROW(scene->insert<Velocity>(scene->create_many(3), std::span<Velocity const> { velocities }), std::invalid_argument);
+}
+
+TEST_F(SceneTest, GenerateMany)
+{
+    CREATE_SCENE;
+
+    auto const entities = scene->create_many(50);
+    int next = 0;
+
+    scene->generate<Position>(entities, [&next] (entt::entity) {
+        return Position { next++ };
+    });
+
+    EXPECT_EQ(scene->filtered<Position const>().size_hint(), 50u);
+    EXPECT_EQ(scene->handle(entities.back()).get<Position>().value, 49);
+}
+
+/* Groups */
+
+namespace
+{
+    struct Dead {};
+}
+
+TEST_F(SceneTest, Grouped)
+{
+    CREATE_SCENE;
+
+    auto const entities = scene->create_many(30);
+
+    scene->insert<Position>(entities);
+    scene->insert<Velocity>(std::span { entities }.first(20), Velocity { 2 });
+    scene->insert<Dead>(std::span { entities }.first(5));
+
+    auto group = scene->grouped<Position>(entt::get<Velocity const>, entt::exclude<Dead>);
+
+    EXPECT_EQ(group.size(), 15u);
+
+    group.each([] (Position& position, Velocity const& velocity) {
+        position.value += velocity.value;
+    });
+
+    for (std::size_t i = 0; i < entities.size(); ++i)
+        EXPECT_EQ(scene->handle(entities[i]).get<Position>().value, i >= 5 && i < 20 ? 2 : 0);
+
+    EXPECT_NO_THROW(static_cast<void>(scene->grouped<Position>(entt::get<Velocity>, entt::exclude<Dead>)));
+}
+
+TEST_F(SceneTest, GroupedConflict)
+{
+    CREATE_SCENE;
+
+    static_cast<void>(scene->grouped<Position, Velocity const>());
+
+    EXPECT_THROW(static_cast<void>(scene->grouped<Position>()), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(scene->grouped<Velocity>(entt::get<Dead>)), std::invalid_argument);
+    EXPECT_NO_THROW(static_cast<void>(scene->grouped<Dead>(entt::get<Position>)));
+}
+
+/* Layers */
+
+namespace
+{
+    template <class View>
+    [[nodiscard]] bool layer_ordered(View const& view)
+    {
+        std::vector<long long> layers;
+
+        view.each([&layers] (Game::Components::Layer const& layer, auto const&...) {
+            layers.push_back(layer.layer());
+        });
+
+        return std::ranges::is_sorted(layers);
+    }
+}
+
+TEST_F(SceneTest, LayerOrder)
+{
+    CREATE_SCENE;
+
+    EXPECT_FALSE(scene->update_layer_order());
+
+    auto const entities = scene->create_many(100);
+
+    scene->generate<Game::Components::Layer>(entities, [] (entt::entity const entity) {
+        return Game::Components::Layer { static_cast<long long>(entt::to_entity(entity) * 37 % 11) };
+    });
+
+    scene->insert<Position>(std::span { entities }.first(60));
+    scene->keep_layer_order<Position>();
+
+    EXPECT_TRUE(layer_ordered(scene->filtered<Game::Components::Layer const>()));
+    EXPECT_TRUE(layer_ordered(scene->filtered<Game::Components::Layer const, Position const>()));
+    EXPECT_FALSE(scene->update_layer_order());
+
+    scene->handle(entities[10]).patch<Game::Components::Layer>([] (Game::Components::Layer& layer) {
+        layer.layer(-1);
+    });
+
+    scene->destroy(scene->handle(entities[20]));
+    scene->handle(entities[80]).emplace<Position>();
+
+    EXPECT_TRUE(scene->update_layer_order());
+    EXPECT_FALSE(scene->update_layer_order());
+
+    EXPECT_TRUE(layer_ordered(scene->filtered<Game::Components::Layer const, Position const>()));
+    EXPECT_EQ(*scene->filtered<Game::Components::Layer const>().begin(), entities[10]);
+}
+
+TEST_F(SceneTest, LayerOrderSpawn)
+{
+    CREATE_SCENE;
+
+    auto const first = scene->create_many(10);
+
+    scene->insert<Game::Components::Layer>(first, Game::Components::Layer { 5 });
+    scene->keep_layer_order<Position>();
+
+    auto const second = scene->create_many(1000);
+
+    scene->generate<Game::Components::Layer>(second, [] (entt::entity const entity) {
+        return Game::Components::Layer { static_cast<long long>(entt::to_entity(entity) * 37 % 11) };
+    });
+
+    scene->insert<Position>(second);
+
+    EXPECT_TRUE(scene->update_layer_order());
+    EXPECT_TRUE(layer_ordered(scene->filtered<Game::Components::Layer const>()));
+    EXPECT_TRUE(layer_ordered(scene->filtered<Game::Components::Layer const, Position const>()));
+
+    auto const view = scene->filtered<Game::Components::Layer const>();
+    std::vector<entt::entity> const sorted { view.begin(), view.end() };
+
+    for (auto const entity : second)
+        scene->handle(entity).patch<Game::Components::Layer>();
+
+    EXPECT_TRUE(scene->update_layer_order());
+    EXPECT_EQ((std::vector<entt::entity> { view.begin(), view.end() }), sorted);
+}
+
+TEST_F(SceneTest, LayerOrderOutlivesScene)
+{
+    CREATE_SCENE;
+
+    auto object = scene->create();
+
+    object.emplace<Game::Components::Layer>(2);
+    scene->keep_layer_order<Position>();
+
+    auto const access = std::make_unique<Game::SceneAccess>(*scene);
+    scene.reset();
+
+    object.emplace<Position>();
+    object.patch<Game::Components::Layer>([] (Game::Components::Layer& layer) { layer.layer(1); });
+    object.destroy<Game::Components::Layer>();
+
+    EXPECT_TRUE(access->contains<Position>(object.entity()));
+    EXPECT_FALSE(access->contains<Game::Components::Layer>(object.entity()));
+}
+
+TEST_F(SceneTest, LayerOrderGrouped)
+{
+    CREATE_SCENE;
+
+    static_cast<void>(scene->grouped<Velocity>());
+
+    scene->keep_layer_order<Position>();
+
+    EXPECT_THROW(static_cast<void>(scene->grouped<Game::Components::Layer>()), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(scene->grouped<Position>()), std::invalid_argument);
+    EXPECT_THROW(scene->keep_layer_order<Velocity>(), std::invalid_argument);
+}
@@ -0,0 +1,169 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include "frame_services.h"
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Position { int value = 0; };
+    struct Velocity { int value = 1; };
+
+    class MoveSystem final :
+        public Generic::BatchSystemBase<Position, Velocity const>
+    {
+    public:
+        void process(std::span<Position> positions, std::span<Velocity const> velocities) override
+        {
+            EXPECT_EQ(positions.size(), velocities.size());
+            myProcessed += positions.size();
+
+            for (std::size_t i = 0; i < positions.size(); ++i)
+                positions[i].value += velocities[i].value;
+        }
+
+        void update() override {}
+
+        std::size_t myProcessed = 0;
+    };
+
+    struct Mass
+    {
+        explicit Mass(int value) :
+            value (std::make_unique<int>(value))
+        {}
+
+        std::unique_ptr<int> value;
+    };
+
+    class GroupedMoveSystem final :
+        public Generic::BatchSystemBase<entt::owned_t<Position, Mass const>, Velocity const>
+    {
+    public:
+        void process(std::span<Position> positions, std::span<Mass const> masses, std::span<Velocity const> velocities) override
+        {
+            EXPECT_EQ(positions.size(), masses.size());
+            EXPECT_EQ(positions.size(), velocities.size());
+            myProcessed += positions.size();
+
+            for (std::size_t i = 0; i < positions.size(); ++i)
+                positions[i].value += velocities[i].value * *masses[i].value;
+        }
+
+        void update() override {}
+
+        std::size_t myProcessed = 0;
+    };
+}
+
+class BatchSystemTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_unique<Game::Scene>();
+            services = std::make_unique<FrameServices>(0);
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        services.reset();
+        scene.reset();
+    }
+
+    void execute(Generic::Detail::SystemBase& system)
+    {
+        auto const frame = services->frame();
+
+        system.prepare(*scene, frame);
+        system.execute(*scene, frame);
+    }
+
+    std::unique_ptr<Game::Scene> scene;
+    std::unique_ptr<FrameServices> services;
+};
+
+/* Execute */
+
+TEST_F(BatchSystemTest, AlignedStorages)
+{
+    for (int i = 0; i < 3000; ++i) {
+        auto object = scene->create();
+
+        object.emplace<Position>();
+        object.emplace<Velocity>(2);
+    }
+
+    MoveSystem system;
+    execute(system);
+
+    EXPECT_EQ(system.myProcessed, 3000u);
+
+    scene->filtered<Position const>().each([] (Position const& position) {
+        EXPECT_EQ(position.value, 2);
+    });
+}
+
+TEST_F(BatchSystemTest, GatheredStorages)
+{
+    std::vector<Game::ObjectHandle> objects;
+
+    for (int i = 0; i < 3000; ++i) {
+        objects.push_back(scene->create());
+        objects.back().emplace<Position>();
+    }
+
+    for (auto i = objects.size(); i-- > 0; )
+        if (i % 3 != 0)
+            objects[i].emplace<Velocity>(3);
+
+    MoveSystem system;
+    execute(system);
+
+    EXPECT_EQ(system.myProcessed, 2000u);
+
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        EXPECT_EQ(objects[i].get<Position>().value, i % 3 != 0 ? 3 : 0);
+}
+
+TEST_F(BatchSystemTest, OwnedStorages)
+{
+    std::vector<Game::ObjectHandle> objects;
+
+    for (int i = 0; i < 3000; ++i) {
+        objects.push_back(scene->create());
+        objects.back().emplace<Position>();
+
+        if (i % 2 == 0)
+            objects.back().emplace<Mass>(2);
+    }
+
+    for (auto i = objects.size(); i-- > 0; )
+        if (i % 3 != 0)
+            objects[i].emplace<Velocity>(3);
+
+    GroupedMoveSystem system;
+    execute(system);
+
+    EXPECT_EQ(system.myProcessed, 1000u);
+    EXPECT_EQ(system.processed(), 1000u);
+
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        EXPECT_EQ(objects[i].get<Position>().value, i % 2 == 0 && i % 3 != 0 ? 6 : 0);
+}
+
+TEST_F(BatchSystemTest, BudgetPolicy)
+{
+    MoveSystem system;
+
+    EXPECT_THROW(system.run_policy(Generic::RunPolicy::budget(std::chrono::milliseconds(1))), std::invalid_argument);
+    EXPECT_NO_THROW(system.run_policy(Generic::RunPolicy::every(2)));
+}
@@ -0,0 +1,329 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+
+using namespace Coli;
+
+namespace
+{
+    struct Counter { int value = 0; };
+
+    class StopSystem final :
+        public Generic::SystemBase<Counter>
+    {
+    public:
+        StopSystem(Generic::Engine& engine, std::uint64_t frames) noexcept :
+            myEngine (engine),
+            myFrames (frames)
+        {}
+
+        void process(Counter& counter) override {
+            ++counter.value;
+        }
+
+        void update() override
+        {
+            deltas.push_back(frame().delta());
+            alphas.push_back(frame().alpha());
+            indices.push_back(frame().index());
+            ticks.push_back(frame().timers().wheel().now());
+
+            if (frame().index() + 1 >= myFrames)
+                myEngine.stop();
+        }
+
+        std::vector<Types::float_type> deltas;
+        std::vector<Types::float_type> alphas;
+        std::vector<std::uint64_t> indices;
+        std::vector<std::uint64_t> ticks;
+
+    private:
+        Generic::Engine& myEngine;
+        std::uint64_t myFrames;
+    };
+
+    struct Spawned { std::uint64_t frame = 0; };
+
+    class SpawnSystem final :
+        public Generic::SystemBase<Counter const>
+    {
+    public:
+        void process(Counter const&) override
+        {
+            auto& commands = frame().commands();
+            commands.emplace<Spawned>(commands.create(), frame().index());
+        }
+
+        void update() override {}
+    };
+}
+
+class EngineTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_shared<Game::Scene>();
+            engine = std::make_unique<Generic::Engine>();
+
+            scene->create().emplace<Counter>();
+            engine->active_scene(scene);
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        engine.reset();
+        scene.reset();
+    }
+
+    std::shared_ptr<Game::Scene> scene;
+    std::unique_ptr<Generic::Engine> engine;
+};
+
+/* Loop settings */
+
+TEST_F(EngineTest, InvalidLoopSettings)
+{
+    Generic::Engine::LoopSettings settings;
+
+    settings.step = std::chrono::nanoseconds::zero();
+    EXPECT_THROW(engine->loop_settings(settings), std::invalid_argument);
+
+    settings.step = std::chrono::milliseconds(1);
+    settings.max_catch_up = 0;
+    EXPECT_THROW(engine->loop_settings(settings), std::invalid_argument);
+
+    EXPECT_EQ(engine->loop_settings().mode, Generic::Engine::LoopMode::Continuous);
+}
+
+/* Run */
+
+TEST_F(EngineTest, FixedStep)
+{
+    Generic::Engine::LoopSettings settings;
+
+    settings.mode = Generic::Engine::LoopMode::FixedStep;
+    settings.step = std::chrono::milliseconds(2);
+
+    ASSERT_NO_THROW(engine->loop_settings(settings));
+
+    auto const system = engine->make_system<StopSystem>(*engine, 10).lock();
+    ASSERT_TRUE(system);
+
+    auto const start = std::chrono::steady_clock::now();
+    engine->run();
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_GE(elapsed, std::chrono::milliseconds(18));
+    ASSERT_EQ(system->indices.size(), 10u);
+
+    for (std::size_t i = 0; i < system->indices.size(); ++i) {
+        EXPECT_EQ(system->indices[i], i);
+        EXPECT_FLOAT_EQ(system->deltas[i], 0.002f);
+        EXPECT_GE(system->alphas[i], 0);
+        EXPECT_LT(system->alphas[i], 1);
+    }
+}
+
+TEST_F(EngineTest, Continuous)
+{
+    auto const system = engine->make_system<StopSystem>(*engine, 5).lock();
+    ASSERT_TRUE(system);
+
+    engine->run();
+
+    ASSERT_EQ(system->indices.size(), 5u);
+
+    for (std::size_t i = 0; i < system->indices.size(); ++i) {
+        EXPECT_GE(system->deltas[i], 0);
+        EXPECT_EQ(system->alphas[i], 1);
+    }
+}
+
+TEST_F(EngineTest, StopFromThread)
+{
+    Generic::Engine::LoopSettings settings;
+
+    settings.mode = Generic::Engine::LoopMode::FixedStep;
+    settings.step = std::chrono::milliseconds(1);
+
+    ASSERT_NO_THROW(engine->loop_settings(settings));
+    ASSERT_NO_THROW(engine->make_system<StopSystem>(*engine, std::numeric_limits<std::uint64_t>::max()));
+
+    std::thread stopper { [this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        engine->stop();
+    }};
+
+    engine->run();
+    stopper.join();
+
+    scene->filtered<Counter const>().each([] (Counter const& counter) {
+        EXPECT_GT(counter.value, 0);
+    });
+}
+
+TEST_F(EngineTest, ExpiredScene)
+{
+    ASSERT_NO_THROW(engine->make_system<StopSystem>(*engine, std::numeric_limits<std::uint64_t>::max()));
+
+    scene.reset();
+    engine->run();
+
+    SUCCEED();
+}
+
+/* On demand */
+
+TEST_F(EngineTest, OnDemandIdle)
+{
+    Generic::Engine::LoopSettings settings;
+    settings.mode = Generic::Engine::LoopMode::OnDemand;
+
+    ASSERT_NO_THROW(engine->loop_settings(settings));
+    auto const system = engine->make_system<StopSystem>(*engine, std::numeric_limits<std::uint64_t>::max()).lock();
+
+    std::thread stopper { [this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        engine->stop();
+    }};
+
+    engine->run();
+    stopper.join();
+
+    EXPECT_TRUE(system->indices.empty());
+}
+
+TEST_F(EngineTest, OnDemandStep)
+{
+    Generic::Engine::LoopSettings settings;
+
+    settings.mode = Generic::Engine::LoopMode::OnDemand;
+    settings.step = std::chrono::milliseconds(2);
+
+    ASSERT_NO_THROW(engine->loop_settings(settings));
+    auto const system = engine->make_system<StopSystem>(*engine, 3).lock();
+
+    std::thread requester { [this] {
+        engine->step(3);
+    }};
+
+    engine->run();
+    requester.join();
+
+    ASSERT_EQ(system->deltas.size(), 3u);
+
+    for (auto const delta : system->deltas)
+        EXPECT_FLOAT_EQ(delta, 0.002f);
+}
+
+TEST_F(EngineTest, OnDemandRedraw)
+{
+    Generic::Engine::LoopSettings settings;
+    settings.mode = Generic::Engine::LoopMode::OnDemand;
+
+    ASSERT_NO_THROW(engine->loop_settings(settings));
+    auto const system = engine->make_system<StopSystem>(*engine, 1).lock();
+
+    std::thread requester { [this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        engine->request_redraw();
+    }};
+
+    engine->run();
+    requester.join();
+
+    ASSERT_EQ(system->deltas.size(), 1u);
+    EXPECT_EQ(system->deltas[0], 0);
+    EXPECT_EQ(system->ticks[0], 0u);
+}
+
+TEST_F(EngineTest, OnDemandPost)
+{
+    using namespace std::chrono_literals;
+
+    Generic::Engine::LoopSettings settings;
+    settings.mode = Generic::Engine::LoopMode::OnDemand;
+
+    ASSERT_NO_THROW(engine->loop_settings(settings));
+    auto const system = engine->make_system<StopSystem>(*engine, 2).lock();
+
+    std::vector<int> order;
+
+    EXPECT_THROW(engine->post({}), std::invalid_argument);
+
+    engine->post([&order] { order.push_back(2); }, 10ms);
+    engine->post([&order] { order.push_back(1); });
+
+    engine->run();
+
+    ASSERT_EQ(order.size(), 2u);
+    EXPECT_EQ(order[0], 1);
+    EXPECT_EQ(order[1], 2);
+
+    ASSERT_EQ(system->deltas.size(), 2u);
+    EXPECT_EQ(system->deltas[0], 0);
+}
+
+TEST_F(EngineTest, MovedFrom)
+{
+    Generic::Engine moved { std::move(*engine) };
+
+    EXPECT_NO_THROW(engine->request_redraw());
+    EXPECT_NO_THROW(engine->step(2));
+    EXPECT_NO_THROW(engine->stop());
+    EXPECT_THROW(engine->post([] {}), std::logic_error);
+
+    EXPECT_NO_THROW(moved.post([] {}));
+    EXPECT_NO_THROW(moved.request_redraw());
+}
+
+/* Systems */
+
+TEST_F(EngineTest, SystemRegistry)
+{
+    EXPECT_EQ(engine->find_system<StopSystem>(), nullptr);
+    EXPECT_TRUE(engine->get_system<StopSystem>().expired());
+
+    auto const made = engine->make_system<StopSystem>(*engine, 1).lock();
+
+    ASSERT_TRUE(made);
+    EXPECT_THROW(engine->make_system<StopSystem>(*engine, 1), std::logic_error);
+
+    EXPECT_EQ(engine->find_system<StopSystem>(), made.get());
+    EXPECT_EQ(std::as_const(*engine).find_system<StopSystem const>(), made.get());
+    EXPECT_EQ(engine->get_system<StopSystem>().lock(), made);
+
+    engine->remove_system<StopSystem>();
+
+    EXPECT_EQ(engine->find_system<StopSystem>(), nullptr);
+    EXPECT_TRUE(engine->get_system<StopSystem>().expired());
+    EXPECT_NO_THROW(engine->make_system<StopSystem>(*engine, 1));
+}
+
+/* Commands */
+
+TEST_F(EngineTest, CommandsFlushedAfterFrame)
+{
+    ASSERT_NO_THROW(engine->make_system<SpawnSystem>());
+
+    engine->run_frames(2);
+
+    std::vector<std::uint64_t> frames;
+
+    scene->filtered<Spawned const>().each([&] (Spawned const& spawned) {
+        frames.push_back(spawned.frame);
+    });
+
+    std::ranges::sort(frames);
+
+    EXPECT_EQ(frames, (std::vector<std::uint64_t> { 0, 1 }));
+    EXPECT_TRUE(engine->commands().local().empty());
+}
@@ -0,0 +1,252 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+
+using namespace Coli;
+
+namespace
+{
+    struct Counter { int value = 0; };
+
+    struct Hit { int damage = 0; };
+    struct Spawn { std::uint64_t frame = 0; };
+
+    struct Moved
+    {
+        explicit Moved(int value) noexcept :
+            value (value)
+        {}
+
+        Moved(Moved&& other) noexcept :
+            value (other.value)
+        {
+            ++moves;
+        }
+
+        Moved& operator=(Moved&& other) noexcept
+        {
+            value = other.value;
+            ++moves;
+
+            return *this;
+        }
+
+        int value;
+
+        static inline std::size_t moves = 0;
+    };
+
+    class HitSystem final :
+        public Generic::SystemBase<Counter const>
+    {
+    public:
+        void process(Counter const&) override {
+            frame().events().publish<Hit>(2);
+        }
+
+        void update() override {}
+    };
+
+    class DamageSystem final :
+        public Generic::SystemBase<Counter const>
+    {
+    public:
+        void process(Counter const&) override {}
+
+        void update() override
+        {
+            int damage = 0;
+
+            for (auto const& hit : frame().events().read<Hit>())
+                damage += hit.damage;
+
+            damages.push_back(damage);
+        }
+
+        std::vector<int> damages;
+    };
+}
+
+class EventBusTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            workers = std::make_unique<Generic::WorkerPool>(2);
+            events = std::make_unique<Generic::EventBus>(workers->slot_count());
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        events.reset();
+        workers.reset();
+    }
+
+    std::unique_ptr<Generic::WorkerPool> workers;
+    std::unique_ptr<Generic::EventBus> events;
+};
+
+/* Publish */
+
+TEST_F(EventBusTest, ReadableAfterSwap)
+{
+    events->publish<Hit>(3);
+    events->publish<Spawn>(7u);
+
+    EXPECT_TRUE(events->read<Hit>().empty());
+
+    events->swap();
+
+    ASSERT_EQ(events->read<Hit>().size(), 1u);
+    ASSERT_EQ(events->read<Spawn>().size(), 1u);
+    EXPECT_EQ(events->read<Hit>().front().damage, 3);
+    EXPECT_EQ(events->read<Spawn>().front().frame, 7u);
+
+    events->swap();
+
+    EXPECT_TRUE(events->read<Hit>().empty());
+    EXPECT_TRUE(events->read<Spawn>().empty());
+}
+
+TEST_F(EventBusTest, UnknownType)
+{
+    struct Unknown {};
+
+    EXPECT_TRUE(events->read<Unknown>().empty());
+    EXPECT_EQ(events->counter<Unknown>().total, 0u);
+    EXPECT_EQ(events->counter<Unknown>().type, entt::type_hash<Unknown>::value());
+}
+
+TEST_F(EventBusTest, ParallelPublish)
+{
+    workers->parallel_for(0, 10000, 64, [this] (std::size_t const first, std::size_t const last) {
+        for (auto i = first; i < last; ++i)
+            events->publish<Hit>(1);
+    });
+
+    events->swap();
+
+    int damage = 0;
+
+    for (auto const& hit : events->read<Hit>())
+        damage += hit.damage;
+
+    EXPECT_EQ(damage, 10000);
+}
+
+TEST_F(EventBusTest, SingleBufferSwap)
+{
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        for (int i = 0; i < 100; ++i)
+            events->publish<Moved>(frame);
+
+        auto const moves = Moved::moves;
+        events->swap();
+
+        EXPECT_EQ(Moved::moves, moves);
+
+        auto const read = events->read<Moved>();
+
+        ASSERT_EQ(read.size(), 100u);
+        EXPECT_TRUE(std::ranges::all_of(read, [frame] (Moved const& moved) { return moved.value == frame; }));
+    }
+}
+
+TEST_F(EventBusTest, ExternalPublish)
+{
+    std::vector<std::thread> threads;
+
+    for (int thread = 0; thread < 2; ++thread)
+        threads.emplace_back([this] {
+            for (int i = 0; i < 1000; ++i)
+                events->publish<Hit>(1);
+        });
+
+    workers->parallel_for(0, 10000, 64, [this] (std::size_t const first, std::size_t const last) {
+        for (auto i = first; i < last; ++i)
+            events->publish<Hit>(1);
+    });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    events->swap();
+
+    int damage = 0;
+
+    for (auto const& hit : events->read<Hit>())
+        damage += hit.damage;
+
+    EXPECT_EQ(damage, 12000);
+    EXPECT_EQ(events->counter<Hit>().frame, 12000u);
+}
+
+TEST_F(EventBusTest, Counters)
+{
+    for (int frame = 0; frame < 3; ++frame) {
+        for (int i = 0; i <= frame; ++i)
+            events->publish<Hit>(i);
+
+        events->publish<Spawn>();
+        events->swap();
+    }
+
+    auto const hits = events->counter<Hit>();
+
+    EXPECT_EQ(hits.frame, 3u);
+    EXPECT_EQ(hits.total, 6u);
+
+    auto const counters = events->counters();
+
+    ASSERT_EQ(counters.size(), 2u);
+    EXPECT_EQ(counters[0].type, entt::type_hash<Hit>::value());
+    EXPECT_EQ(counters[1].total, 3u);
+}
+
+TEST_F(EventBusTest, Clear)
+{
+    events->publish<Hit>();
+    events->swap();
+    events->publish<Hit>();
+    events->clear();
+
+    EXPECT_TRUE(events->read<Hit>().empty());
+
+    events->swap();
+
+    EXPECT_TRUE(events->read<Hit>().empty());
+    EXPECT_EQ(events->counter<Hit>().total, 1u);
+}
+
+/* Engine */
+
+TEST_F(EventBusTest, NextFrame)
+{
+    auto const scene = std::make_shared<Game::Scene>();
+
+    for (int i = 0; i < 10; ++i)
+        scene->create().emplace<Counter>();
+
+    Generic::Engine engine;
+    engine.active_scene(scene);
+
+    ASSERT_NO_THROW(engine.make_system<HitSystem>());
+    auto const damage = engine.make_system<DamageSystem>().lock();
+
+    engine.run_frames(3);
+
+    ASSERT_EQ(damage->damages.size(), 3u);
+    EXPECT_EQ(damage->damages[0], 0);
+    EXPECT_EQ(damage->damages[1], 20);
+    EXPECT_EQ(damage->damages[2], 20);
+
+    EXPECT_EQ(engine.events().counter<Hit>().total, 30u);
+}
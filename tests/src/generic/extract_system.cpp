@@ -0,0 +1,143 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+
+using namespace Coli;
+
+namespace
+{
+    struct Position { int value = 0; };
+
+    struct Item
+    {
+        int position;
+        std::uint64_t frame;
+    };
+
+    class MoveSystem final :
+        public Generic::SystemBase<Position>
+    {
+    public:
+        void process(Position& position) override {
+            ++position.value;
+        }
+
+        void update() override {}
+    };
+
+    class ExtractSystem final :
+        public Generic::ExtractSystemBase<Item, Position>
+    {
+    public:
+        explicit ExtractSystem(Generic::RenderExchange<Item>& exchange) noexcept :
+            ExtractSystemBase (exchange)
+        {}
+
+        void extract(std::vector<Item>& items, Position const& position) override {
+            items.push_back({ position.value, frame().index() });
+        }
+    };
+}
+
+class ExtractSystemTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_shared<Game::Scene>();
+            engine = std::make_unique<Generic::Engine>();
+            exchange = std::make_unique<Generic::RenderExchange<Item>>();
+
+            for (int i = 0; i < 100; ++i)
+                scene->create().emplace<Position>();
+
+            engine->active_scene(scene);
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        engine.reset();
+        exchange.reset();
+        scene.reset();
+    }
+
+    std::shared_ptr<Game::Scene> scene;
+    std::unique_ptr<Generic::Engine> engine;
+    std::unique_ptr<Generic::RenderExchange<Item>> exchange;
+};
+
+/* Exchange */
+
+TEST_F(ExtractSystemTest, ExchangeBuffers)
+{
+    EXPECT_EQ(exchange->try_acquire(), nullptr);
+
+    auto& first = exchange->write();
+    first.frame = 1;
+    exchange->publish();
+
+    auto const* const read = exchange->acquire();
+
+    ASSERT_NE(read, nullptr);
+    EXPECT_EQ(read->frame, 1u);
+    EXPECT_EQ(exchange->try_acquire(), nullptr);
+
+    auto& second = exchange->write();
+
+    EXPECT_NE(std::addressof(second), read);
+
+    second.frame = 2;
+    exchange->publish();
+    exchange->release();
+
+    ASSERT_NE(exchange->try_acquire(), nullptr);
+    exchange->release();
+
+    exchange->close();
+
+    EXPECT_TRUE(exchange->closed());
+    EXPECT_EQ(exchange->acquire(), nullptr);
+}
+
+/* Pipeline */
+
+TEST_F(ExtractSystemTest, RenderThread)
+{
+    constexpr std::size_t frames = 200;
+
+    ASSERT_NO_THROW(engine->make_system<MoveSystem>());
+    ASSERT_NO_THROW(engine->make_system<ExtractSystem>(*exchange));
+
+    std::vector<std::uint64_t> rendered;
+    bool consistent = true;
+
+    std::thread renderer { [&] {
+        while (auto const* const snapshot = exchange->acquire())
+        {
+            for (auto const& item : snapshot->items)
+                consistent &= item.frame == snapshot->frame &&
+                              item.position == static_cast<int>(snapshot->frame) + 1;
+
+            consistent &= snapshot->items.size() == 100;
+            rendered.push_back(snapshot->frame);
+
+            exchange->release();
+        }
+    } };
+
+    engine->run_frames(frames);
+    exchange->close();
+    renderer.join();
+
+    EXPECT_TRUE(consistent);
+    ASSERT_FALSE(rendered.empty());
+    EXPECT_TRUE(std::ranges::is_sorted(rendered));
+    EXPECT_EQ(std::ranges::adjacent_find(rendered), rendered.end());
+}
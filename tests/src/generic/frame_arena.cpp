@@ -0,0 +1,145 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Value { int value = 1; };
+
+    class SortSystem final :
+        public Generic::SystemBase<Value const>
+    {
+    public:
+        void process(Value const&) override {}
+
+        void update() override
+        {
+            std::pmr::vector<int> keys { frame().memory() };
+
+            for (int i = 0; i < 1000; ++i)
+                keys.push_back(1000 - i);
+
+            std::ranges::sort(keys);
+            sorted = keys.front() == 1;
+        }
+
+        bool sorted = false;
+    };
+}
+
+class FrameArenaTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            arena = std::make_unique<Generic::LinearArena>(256);
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        arena.reset();
+    }
+
+    std::unique_ptr<Generic::LinearArena> arena;
+};
+
+/* Allocate */
+
+TEST_F(FrameArenaTest, Alignment)
+{
+    for (std::size_t alignment = 1; alignment <= 128; alignment *= 2)
+    {
+        auto* const pointer = arena->allocate(3, alignment);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pointer) % alignment, 0u);
+    }
+}
+
+TEST_F(FrameArenaTest, Grow)
+{
+    std::pmr::vector<std::uint64_t> values { arena.get() };
+
+    for (std::uint64_t i = 0; i < 1000; ++i)
+        values.push_back(i);
+
+    for (std::uint64_t i = 0; i < values.size(); ++i)
+        ASSERT_EQ(values[i], i);
+
+    EXPECT_GT(arena->capacity(), 256u);
+    EXPECT_GE(arena->used(), 1000 * sizeof(std::uint64_t));
+}
+
+/* Reset */
+
+TEST_F(FrameArenaTest, Reset)
+{
+    static_cast<void>(arena->allocate(1000));
+    static_cast<void>(arena->allocate(1000));
+
+    auto const used = arena->used();
+    auto const capacity = arena->capacity();
+
+    arena->reset();
+
+    EXPECT_EQ(arena->used(), 0u);
+    EXPECT_EQ(arena->high_water(), used);
+    EXPECT_EQ(arena->capacity(), capacity);
+
+    static_cast<void>(arena->allocate(1000));
+    static_cast<void>(arena->allocate(1000));
+
+    EXPECT_EQ(arena->capacity(), capacity);
+}
+
+/* Frame arena */
+
+TEST_F(FrameArenaTest, Slots)
+{
+    Generic::WorkerPool workers { 2 };
+    Generic::FrameArena frame { workers.slot_count(), 256 };
+
+    EXPECT_EQ(frame.size(), 3u);
+    EXPECT_EQ(std::addressof(frame.local()), std::addressof(frame[0]));
+
+    std::atomic<std::size_t> mismatches = 0;
+
+    workers.parallel_for(0, 64, 1, [&] (std::size_t, std::size_t)
+    {
+        auto& local = frame.local();
+
+        if (std::addressof(local) != std::addressof(frame[Generic::WorkerPool::current_slot()]))
+            ++mismatches;
+
+        static_cast<void>(local.allocate(100));
+    });
+
+    EXPECT_EQ(mismatches.load(), 0u);
+
+    frame.reset();
+    EXPECT_GE(frame.high_water(), 64 * 100u);
+}
+
+TEST_F(FrameArenaTest, Engine)
+{
+    auto const scene = std::make_shared<Game::Scene>();
+    Generic::Engine engine;
+
+    scene->create().emplace<Value>();
+    engine.active_scene(scene);
+
+    auto const system = engine.make_system<SortSystem>().lock();
+    ASSERT_TRUE(system);
+
+    ASSERT_NO_THROW(engine.run_frames(3));
+
+    EXPECT_TRUE(system->sorted);
+    EXPECT_GE(engine.arena().high_water(), 1000 * sizeof(int));
+    EXPECT_EQ(engine.arena()[0].used(), 0u);
+}
@@ -0,0 +1,68 @@
+#ifndef COLI_TESTS_GENERIC_FRAME_SERVICES_H
+#define COLI_TESTS_GENERIC_FRAME_SERVICES_H
+
+#include <coli/game-engine.h>
+
+/**
+ * @brief Frame services of the system tests.
+ * @details Owns a worker pool and the per slot services the engine
+ * passes to the systems, and makes the frame contexts on them.
+ */
+class FrameServices final
+{
+public:
+    /**
+     * @brief Creates frame services.
+     * @details Starts the worker pool and creates the services
+     * for its slots.
+     *
+     * @param workers Count of the worker threads.
+     *
+     * @throw std::bad_alloc If allocation fails;
+     * @throw std::system_error If a thread cannot be started.
+     */
+    explicit FrameServices(std::size_t const workers) :
+        myWorkers  (workers),
+        myArena    (myWorkers.slot_count()),
+        myCommands (myWorkers.slot_count()),
+        myEvents   (myWorkers.slot_count()),
+        myTimers   (myWorkers.slot_count())
+    {}
+
+    /**
+     * @brief Returns worker pool.
+     * @details Returns the pool the frames are executed on.
+     *
+     * @return Reference to the worker pool.
+     */
+    [[nodiscard]] Coli::Generic::WorkerPool& workers() noexcept {
+        return myWorkers;
+    }
+
+    /**
+     * @brief Makes frame.
+     * @details Makes a frame context on the services.
+     *
+     * @param delta Simulated time of the frame in seconds;
+     * @param alpha Interpolation factor of the frame;
+     * @param index Index of the frame.
+     *
+     * @return Frame context.
+     */
+    [[nodiscard]] Coli::Generic::Frame frame(
+        Coli::Types::float_type const delta = 0,
+        Coli::Types::float_type const alpha = 1,
+        std::uint64_t const index = 0) noexcept
+    {
+        return Coli::Generic::Frame { myWorkers, myArena, myCommands, myEvents, myTimers, delta, alpha, index };
+    }
+
+private:
+    Coli::Generic::WorkerPool myWorkers;
+    Coli::Generic::FrameArena myArena;
+    Coli::Generic::FrameCommands myCommands;
+    Coli::Generic::EventBus myEvents;
+    Coli::Generic::FrameTimers myTimers;
+};
+
+#endif
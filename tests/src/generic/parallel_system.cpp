@@ -0,0 +1,236 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include "frame_services.h"
+
+#include <memory>
+#include <numeric>
+
+using namespace Coli;
+
+namespace
+{
+    struct Value { long long value = 1; };
+
+    class SumSystem final :
+        public Generic::ParallelSystemBase<Value>
+    {
+    public:
+        [[nodiscard]] std::size_t chunk_size() const noexcept override {
+            return 64;
+        }
+
+        void reserve_slots(std::size_t count) override {
+            myPartial.reset(count, 0);
+        }
+
+        void process(Value& value) override {
+            myPartial.local() += value.value++;
+        }
+
+        void reduce(std::size_t slot) override {
+            mySum += myPartial[slot];
+        }
+
+        void update() override {
+            ++myUpdates;
+        }
+
+        long long mySum = 0;
+        int myUpdates = 0;
+
+    private:
+        Generic::SlotLocal<long long> myPartial;
+    };
+
+    struct Bonus { long long value = 10; };
+    struct Skip {};
+
+    class BonusSystem final :
+        public Generic::ParallelSystemBase<Value const, Bonus const*, entt::exclude_t<Skip>>
+    {
+    public:
+        void process(Value const& value, Bonus const* const bonus) override {
+            myTotal.fetch_add(value.value + (bonus ? bonus->value : 0), std::memory_order_relaxed);
+        }
+
+        void update() override {}
+
+        std::atomic<long long> myTotal = 0;
+    };
+
+    class GroupedSumSystem final :
+        public Generic::ParallelSystemBase<entt::owned_t<Value>, Bonus const>
+    {
+    public:
+        void process(Value& value, Bonus const& bonus) override {
+            value.value += bonus.value;
+        }
+
+        void update() override {}
+    };
+}
+
+class ParallelSystemTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_unique<Game::Scene>();
+            services = std::make_unique<FrameServices>(3);
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        services.reset();
+        scene.reset();
+    }
+
+    std::unique_ptr<Game::Scene> scene;
+    std::unique_ptr<FrameServices> services;
+};
+
+/* Parallel for */
+
+TEST_F(ParallelSystemTest, ParallelForCoversRange)
+{
+    std::vector<int> hits (10'000, 0);
+
+    services->workers().parallel_for(0, hits.size(), 100, [&] (std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i)
+            ++hits[i];
+    });
+
+    EXPECT_TRUE(std::ranges::all_of(hits, [] (int hit) { return hit == 1; }));
+}
+
+TEST_F(ParallelSystemTest, ParallelForRethrows)
+{
+    EXPECT_THROW(
+        services->workers().parallel_for(0, 1000, 10, [] (std::size_t first, std::size_t) {
+            if (first == 500)
+                throw std::runtime_error("chunk failed");
+        }),
+        std::runtime_error);
+}
+
+/* Execute */
+
+TEST_F(ParallelSystemTest, ProcessesAllObjects)
+{
+    constexpr long long count = 5000;
+
+    for (long long i = 0; i < count; ++i)
+        scene->create().emplace<Value>();
+
+    SumSystem system;
+    auto const frame = services->frame();
+
+    system.prepare(*scene, frame);
+    system.execute(*scene, frame);
+    system.execute(*scene, frame);
+
+    EXPECT_EQ(system.mySum, count + count * 2);
+    EXPECT_EQ(system.myUpdates, 2);
+}
+
+TEST_F(ParallelSystemTest, EmptyScene)
+{
+    SumSystem system;
+    auto const frame = services->frame();
+
+    system.prepare(*scene, frame);
+    system.execute(*scene, frame);
+
+    EXPECT_EQ(system.mySum, 0);
+    EXPECT_EQ(system.myUpdates, 1);
+}
+
+TEST_F(ParallelSystemTest, OptionalAndExcluded)
+{
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto object = scene->create();
+        object.emplace<Value>();
+
+        if (i % 2 == 0)
+            object.emplace<Bonus>();
+
+        if (i % 5 == 0)
+            object.emplace<Skip>();
+    }
+
+    BonusSystem system;
+    auto const frame = services->frame();
+
+    system.prepare(*scene, frame);
+    system.execute(*scene, frame);
+
+    EXPECT_EQ(system.processed(), 800u);
+    EXPECT_EQ(system.myTotal.load(), 800 + 400 * 10);
+}
+
+TEST_F(ParallelSystemTest, Grouped)
+{
+    std::vector<Game::ObjectHandle> objects;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        objects.push_back(scene->create());
+        objects.back().emplace<Value>();
+
+        if (i % 2 == 0)
+            objects.back().emplace<Bonus>();
+    }
+
+    GroupedSumSystem system;
+    auto const frame = services->frame();
+
+    system.prepare(*scene, frame);
+    system.execute(*scene, frame);
+
+    EXPECT_EQ(system.processed(), 500u);
+
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        EXPECT_EQ(objects[i].get<Value>().value, i % 2 == 0 ? 11 : 1);
+}
+
+TEST_F(ParallelSystemTest, BudgetPolicy)
+{
+    SumSystem system;
+
+    EXPECT_THROW(system.run_policy(Generic::RunPolicy::budget(std::chrono::milliseconds(1))), std::invalid_argument);
+    EXPECT_NO_THROW(system.run_policy(Generic::RunPolicy::rate(10)));
+}
+
+TEST_F(ParallelSystemTest, SlotLocalRange)
+{
+    Generic::SlotLocal<int> values;
+    values.reset(1);
+
+    EXPECT_NO_THROW(++values.local());
+
+    std::atomic<std::size_t> mismatches = 0;
+
+    services->workers().parallel_for(0, 64, 1, [&] (std::size_t, std::size_t)
+    {
+        bool thrown = false;
+
+        try {
+            static_cast<void>(values.local());
+        }
+        catch (std::out_of_range const&) {
+            thrown = true;
+        }
+
+        if (thrown != (Generic::WorkerPool::current_slot() != 0))
+            ++mismatches;
+    });
+
+    EXPECT_EQ(mismatches.load(), 0u);
+}
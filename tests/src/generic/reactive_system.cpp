@@ -0,0 +1,273 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include "frame_services.h"
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Position { int value = 0; };
+    struct Mirror { int value = 0; };
+
+    class MirrorSystem final :
+        public Generic::ReactiveSystemBase<Position const, Mirror>
+    {
+    public:
+        void process(Position const& position, Mirror& mirror) override {
+            mirror.value = position.value;
+        }
+
+        void update() override {
+            ++myUpdates;
+        }
+
+        std::size_t myUpdates = 0;
+    };
+
+    struct Index { std::size_t value = 0; };
+
+    class CountSystem final :
+        public Generic::ReactiveSystemBase<Position const, Mirror const>
+    {
+    public:
+        void process(Position const&, Mirror const&) override {}
+        void update() override {}
+    };
+
+    template <class T>
+    class PatchSystem final :
+        public Generic::ParallelSystemBase<Index const, T>
+    {
+    public:
+        PatchSystem(std::vector<Game::ObjectHandle>& objects, std::size_t const first, std::size_t const last) noexcept :
+            myObjects (objects),
+            myFirst   (first),
+            myLast    (last)
+        {}
+
+        [[nodiscard]] std::size_t chunk_size() const noexcept override {
+            return 16;
+        }
+
+        void process(Index const& index, T&) override
+        {
+            if (index.value >= myFirst && index.value < myLast)
+                myObjects[index.value].patch<T>([] (T& component) { ++component.value; });
+        }
+
+        void update() override {}
+
+    private:
+        std::vector<Game::ObjectHandle>& myObjects;
+        std::size_t myFirst;
+        std::size_t myLast;
+    };
+}
+
+class ReactiveSystemTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_unique<Game::Scene>();
+            services = std::make_unique<FrameServices>(0);
+
+            for (int i = 0; i < 10; ++i) {
+                objects.push_back(scene->create());
+                objects.back().emplace<Position>(i);
+                objects.back().emplace<Mirror>();
+            }
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        objects.clear();
+        services.reset();
+        scene.reset();
+    }
+
+    void execute(Generic::Detail::SystemBase& system)
+    {
+        auto const frame = services->frame();
+
+        system.prepare(*scene, frame);
+        system.run(*scene, frame);
+    }
+
+    std::unique_ptr<Game::Scene> scene;
+    std::unique_ptr<FrameServices> services;
+    std::vector<Game::ObjectHandle> objects;
+};
+
+/* Execute */
+
+TEST_F(ReactiveSystemTest, FirstExecutionProcessesAll)
+{
+    MirrorSystem system;
+    execute(system);
+
+    EXPECT_EQ(system.processed(), objects.size());
+    EXPECT_EQ(system.myUpdates, 1u);
+
+    for (auto const& object : objects)
+        EXPECT_EQ(object.get<Mirror>().value, object.get<Position>().value);
+}
+
+TEST_F(ReactiveSystemTest, SkipsWithoutChanges)
+{
+    MirrorSystem system;
+
+    execute(system);
+    execute(system);
+
+    EXPECT_EQ(system.processed(), 0u);
+    EXPECT_EQ(system.myUpdates, 1u);
+}
+
+TEST_F(ReactiveSystemTest, ProcessesPatched)
+{
+    MirrorSystem system;
+    execute(system);
+
+    objects[3].patch<Position>([] (Position& position) { position.value = 30; });
+    objects[7].emplace<Position>(70);
+    objects[7].patch<Position>([] (Position& position) { position.value += 1; });
+    objects[5].get<Position>().value = 50;
+
+    execute(system);
+
+    EXPECT_EQ(system.processed(), 2u);
+    EXPECT_EQ(system.myUpdates, 2u);
+    EXPECT_EQ(objects[3].get<Mirror>().value, 30);
+    EXPECT_EQ(objects[7].get<Mirror>().value, 71);
+    EXPECT_EQ(objects[5].get<Mirror>().value, 5);
+}
+
+TEST_F(ReactiveSystemTest, IgnoresRemovedAndDestroyed)
+{
+    MirrorSystem system;
+    execute(system);
+
+    objects[1].patch<Position>([] (Position& position) { position.value = 10; });
+    objects[2].patch<Position>([] (Position& position) { position.value = 20; });
+    objects[1].destroy<Mirror>();
+    scene->destroy(objects[2]);
+
+    auto added = scene->create();
+    added.emplace<Position>(100);
+    added.emplace<Mirror>();
+
+    execute(system);
+
+    EXPECT_EQ(system.processed(), 1u);
+    EXPECT_EQ(added.get<Mirror>().value, 100);
+}
+
+TEST_F(ReactiveSystemTest, PatchFailures)
+{
+    auto object = scene->create();
+
+    EXPECT_THROW(object.patch<Position>(), std::invalid_argument);
+
+    scene->destroy(object);
+    EXPECT_THROW(object.patch<Position>(), std::invalid_argument);
+
+    auto other = std::make_unique<Game::Scene>();
+    auto expired = other->create();
+
+    other.reset();
+    EXPECT_THROW(expired.patch<Position>(), std::bad_weak_ptr);
+}
+
+TEST_F(ReactiveSystemTest, SceneChange)
+{
+    MirrorSystem system;
+    execute(system);
+
+    auto other = std::make_unique<Game::Scene>();
+    auto object = other->create();
+
+    object.emplace<Position>(5);
+    object.emplace<Mirror>();
+
+    auto const frame = services->frame();
+
+    system.prepare(*other, frame);
+    system.run(*other, frame);
+
+    EXPECT_EQ(system.processed(), 1u);
+    EXPECT_EQ(object.get<Mirror>().value, 5);
+
+    other.reset();
+    scene.reset();
+}
+
+TEST_F(ReactiveSystemTest, ParallelPatches)
+{
+    FrameServices pool { 3 };
+
+    objects.clear();
+
+    for (std::size_t i = 0; i < 1000; ++i) {
+        objects.push_back(scene->create());
+        objects.back().emplace<Index>(i);
+        objects.back().emplace<Position>();
+        objects.back().emplace<Mirror>();
+    }
+
+    auto const system = std::make_shared<CountSystem>();
+    Generic::Scheduler scheduler;
+
+    scheduler.add(std::make_shared<PatchSystem<Position>>(objects, 0, 500));
+    scheduler.add(std::make_shared<PatchSystem<Mirror>>(objects, 250, 750));
+    scheduler.add(system);
+
+    for (int frame = 0; frame < 3; ++frame)
+        scheduler.execute(*scene, pool.frame());
+
+    EXPECT_EQ(system->processed(), 750u);
+
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+        EXPECT_EQ(objects[i].get<Position>().value, i < 500 ? 3 : 0);
+        EXPECT_EQ(objects[i].get<Mirror>().value, i >= 250 && i < 750 ? 3 : 0);
+    }
+}
+
+TEST_F(ReactiveSystemTest, ResizedSlots)
+{
+    MirrorSystem system;
+    execute(system);
+
+    objects[1].patch<Position>([] (Position& position) { position.value = 7; });
+
+    FrameServices pool { 2 };
+    auto const frame = pool.frame();
+
+    // The observer keeps the pending changes when the pool changes.
+    system.prepare(*scene, frame);
+    system.run(*scene, frame);
+
+    EXPECT_EQ(system.processed(), 1u);
+    EXPECT_EQ(objects[1].get<Mirror>().value, 7);
+}
+
+TEST_F(ReactiveSystemTest, BudgetPolicy)
+{
+    MirrorSystem system;
+
+    EXPECT_THROW(system.run_policy(Generic::RunPolicy::budget(std::chrono::milliseconds(1))), std::invalid_argument);
+    EXPECT_NO_THROW(system.run_policy(Generic::RunPolicy::every(2)));
+
+    Generic::Shard shard;
+
+    EXPECT_THROW(static_cast<void>(shard.make_system<MirrorSystem>(Generic::RunPolicy::budget(std::chrono::milliseconds(1)))), std::invalid_argument);
+    EXPECT_TRUE(shard.get_system<MirrorSystem>().expired());
+}
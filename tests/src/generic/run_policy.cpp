@@ -0,0 +1,184 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include "frame_services.h"
+
+#include <memory>
+#include <thread>
+
+using namespace Coli;
+
+namespace
+{
+    struct Visits { int value = 0; };
+
+    class CountSystem final :
+        public Generic::SystemBase<Visits>
+    {
+    public:
+        explicit CountSystem(std::chrono::nanoseconds cost = {}) noexcept :
+            myCost (cost)
+        {}
+
+        void process(Visits& visits) override
+        {
+            ++visits.value;
+
+            if (myCost > std::chrono::nanoseconds::zero())
+            {
+                auto const until = std::chrono::steady_clock::now() + myCost;
+                while (std::chrono::steady_clock::now() < until);
+            }
+        }
+
+        void update() override {
+            runs.push_back(elapsed());
+        }
+
+        std::vector<Types::float_type> runs;
+
+    private:
+        std::chrono::nanoseconds myCost;
+    };
+}
+
+class RunPolicyTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_unique<Game::Scene>();
+            services = std::make_unique<FrameServices>(0);
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        services.reset();
+        scene.reset();
+    }
+
+    void populate(int count)
+    {
+        for (int i = 0; i < count; ++i)
+            scene->create().emplace<Visits>();
+    }
+
+    void run(Generic::Detail::SystemBase& system, Types::float_type delta, std::uint64_t index = 0)
+    {
+        auto const frame = services->frame(delta, 1, index);
+
+        system.prepare(*scene, frame);
+        system.run(*scene, frame);
+    }
+
+    std::unique_ptr<Game::Scene> scene;
+    std::unique_ptr<FrameServices> services;
+};
+
+/* Policy */
+
+TEST_F(RunPolicyTest, InvalidPolicies)
+{
+    EXPECT_THROW(static_cast<void>(Generic::RunPolicy::rate(0)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(Generic::RunPolicy::rate(-1)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(Generic::RunPolicy::every(0)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(Generic::RunPolicy::budget(std::chrono::nanoseconds::zero())), std::invalid_argument);
+
+    EXPECT_EQ(Generic::RunPolicy{}.mode(), Generic::RunPolicy::Mode::Always);
+    EXPECT_EQ(Generic::RunPolicy::every(4).frames(), 4u);
+}
+
+/* Execution */
+
+TEST_F(RunPolicyTest, Interval)
+{
+    populate(1);
+
+    CountSystem system;
+    system.run_policy(Generic::RunPolicy::every(3));
+
+    for (int i = 0; i < 7; ++i)
+        run(system, Types::float_type(0.5));
+
+    ASSERT_EQ(system.runs.size(), 3u);
+    EXPECT_FLOAT_EQ(system.runs[0], 0.5f);
+    EXPECT_FLOAT_EQ(system.runs[1], 1.5f);
+    EXPECT_FLOAT_EQ(system.runs[2], 1.5f);
+}
+
+TEST_F(RunPolicyTest, Rate)
+{
+    populate(1);
+
+    CountSystem system;
+    system.run_policy(Generic::RunPolicy::rate(10));
+
+    std::size_t skipped = 0;
+
+    for (int i = 0; i < 30; ++i) {
+        run(system, Types::float_type(0.025));
+        skipped += system.processed() == 0;
+    }
+
+    EXPECT_GE(system.runs.size(), 7u);
+    EXPECT_LE(system.runs.size(), 8u);
+    EXPECT_EQ(skipped + system.runs.size(), 30u);
+}
+
+TEST_F(RunPolicyTest, BudgetResumesRoundRobin)
+{
+    constexpr int count = 200;
+    populate(count);
+
+    CountSystem system { std::chrono::microseconds(20) };
+    system.run_policy(Generic::RunPolicy::budget(std::chrono::milliseconds(1)));
+
+    std::size_t total = 0;
+
+    for (int frame = 0; frame < 40 && total < 2 * count; ++frame)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        run(system, 0);
+        auto const time = std::chrono::steady_clock::now() - start;
+
+        EXPECT_LT(system.processed(), static_cast<std::size_t>(count));
+        EXPECT_LT(time, std::chrono::milliseconds(10));
+
+        total += system.processed();
+    }
+
+    ASSERT_GE(total, 2u * count);
+
+    int low = count, high = 0;
+
+    scene->filtered<Visits const>().each([&] (Visits const& visits) {
+        low = std::min(low, visits.value);
+        high = std::max(high, visits.value);
+    });
+
+    EXPECT_GE(low, 1);
+    EXPECT_LE(high - low, 1);
+}
+
+TEST_F(RunPolicyTest, EngineMakeSystem)
+{
+    auto shared = std::shared_ptr<Game::Scene>(std::move(scene));
+    Generic::Engine engine;
+
+    shared->create().emplace<Visits>();
+    engine.active_scene(shared);
+
+    auto const system = engine.make_system<CountSystem>(Generic::RunPolicy::every(2)).lock();
+
+    ASSERT_TRUE(system);
+    EXPECT_EQ(system->run_policy().mode(), Generic::RunPolicy::Mode::Interval);
+
+    engine.run_frames(5);
+
+    EXPECT_EQ(system->runs.size(), 3u);
+}
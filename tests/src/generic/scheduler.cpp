@@ -0,0 +1,207 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include "frame_services.h"
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Position { int value = 0; };
+    struct Velocity { int value = 1; };
+
+    class OrderLog
+    {
+    public:
+        void push(int id)
+        {
+            std::lock_guard lock { myMutex };
+            myIds.push_back(id);
+        }
+
+        [[nodiscard]] std::vector<int> ids()
+        {
+            std::lock_guard lock { myMutex };
+            return myIds;
+        }
+
+    private:
+        std::mutex myMutex;
+        std::vector<int> myIds;
+    };
+
+    class MoveSystem final :
+        public Generic::SystemBase<Position, Velocity const>
+    {
+    public:
+        MoveSystem(OrderLog& log, int id) :
+            myLog (log), myId (id)
+        {}
+
+        void process(Position& position, Velocity const& velocity) override {
+            position.value += velocity.value;
+        }
+
+        void update() override {
+            myLog.push(myId);
+        }
+
+    private:
+        OrderLog& myLog;
+        int myId;
+    };
+
+    class ReadSystem final :
+        public Generic::SystemBase<Position const>
+    {
+    public:
+        void process(Position const& position) override {
+            mySum += position.value;
+        }
+
+        void update() override {}
+
+        int mySum = 0;
+    };
+
+    class ThrowSystem final :
+        public Generic::SystemBase<Velocity const>
+    {
+    public:
+        void process(Velocity const&) override {}
+
+        void update() override {
+            throw std::runtime_error("system failed");
+        }
+    };
+}
+
+class SchedulerTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_unique<Game::Scene>();
+            services = std::make_unique<FrameServices>(3);
+
+            for (int i = 0; i < 100; ++i) {
+                auto object = scene->create();
+                object.emplace<Position>();
+                object.emplace<Velocity>();
+            }
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        services.reset();
+        scene.reset();
+    }
+
+    std::unique_ptr<Game::Scene> scene;
+    std::unique_ptr<FrameServices> services;
+};
+
+/* Access */
+
+TEST_F(SchedulerTest, ReadersDoNotConflict)
+{
+    Generic::SystemAccess first, second;
+
+    first.declare<Position const>();
+    second.declare<Position const>();
+
+    EXPECT_FALSE(first.conflicts(second));
+}
+
+TEST_F(SchedulerTest, WriterConflictsWithReader)
+{
+    Generic::SystemAccess first, second;
+
+    first.declare<Position>();
+    second.declare<Position const>();
+
+    EXPECT_TRUE(first.conflicts(second));
+    EXPECT_TRUE(second.conflicts(first));
+}
+
+TEST_F(SchedulerTest, DisjointWritersDoNotConflict)
+{
+    Generic::SystemAccess first, second;
+
+    first.declare<Position>();
+    second.declare<Velocity>();
+
+    EXPECT_FALSE(first.conflicts(second));
+}
+
+TEST_F(SchedulerTest, UndeclaredIsExclusive)
+{
+    Generic::SystemAccess first, second;
+    second.declare<Velocity const>();
+
+    EXPECT_TRUE(first.is_exclusive());
+    EXPECT_TRUE(first.conflicts(second));
+}
+
+/* Execute */
+
+TEST_F(SchedulerTest, ConflictingInOrder)
+{
+    OrderLog log;
+    Generic::Scheduler scheduler;
+
+    scheduler.add(std::make_shared<MoveSystem>(log, 1));
+    scheduler.add(std::make_shared<ReadSystem>());
+    scheduler.add(std::make_shared<MoveSystem>(log, 2));
+
+    for (int frame = 0; frame < 10; ++frame)
+        scheduler.execute(*scene, services->frame());
+
+    auto const ids = log.ids();
+    ASSERT_EQ(ids.size(), 20u);
+
+    for (std::size_t i = 0; i < ids.size(); i += 2) {
+        EXPECT_EQ(ids[i], 1);
+        EXPECT_EQ(ids[i + 1], 2);
+    }
+
+    scene->filtered<Position const>().each([] (Position const& position) {
+        EXPECT_EQ(position.value, 20);
+    });
+}
+
+TEST_F(SchedulerTest, RemoveSystem)
+{
+    OrderLog log;
+    Generic::Scheduler scheduler;
+
+    auto const system = std::make_shared<MoveSystem>(log, 1);
+
+    scheduler.add(system);
+    scheduler.add(std::make_shared<MoveSystem>(log, 2));
+    scheduler.remove(system.get());
+
+    scheduler.execute(*scene, services->frame());
+
+    EXPECT_EQ(scheduler.size(), 1u);
+    EXPECT_EQ(log.ids(), std::vector<int>{ 2 });
+}
+
+TEST_F(SchedulerTest, RethrowsSystemException)
+{
+    OrderLog log;
+    Generic::Scheduler scheduler;
+
+    scheduler.add(std::make_shared<ThrowSystem>());
+    scheduler.add(std::make_shared<MoveSystem>(log, 1));
+
+    EXPECT_THROW(scheduler.execute(*scene, services->frame()), std::runtime_error);
+    EXPECT_EQ(log.ids(), std::vector<int>{ 1 });
+}
@@ -0,0 +1,184 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Counter { int value = 0; };
+
+    class CountSystem final :
+        public Generic::SystemBase<Counter>
+    {
+    public:
+        void process(Counter& counter) override {
+            ++counter.value;
+        }
+
+        void update() override {
+            ++myUpdates;
+        }
+
+        std::size_t myUpdates = 0;
+    };
+
+    class ThrowSystem final :
+        public Generic::SystemBase<Counter const>
+    {
+    public:
+        void process(Counter const&) override {}
+
+        void update() override {
+            throw std::runtime_error("shard failure");
+        }
+    };
+}
+
+class ShardTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            engine = std::make_unique<Generic::Engine>();
+
+            Generic::Engine::WorkerSettings settings;
+            settings.count = 2;
+
+            engine->worker_settings(settings);
+
+            for (auto& scene : scenes) {
+                scene = std::make_shared<Game::Scene>();
+
+                for (int i = 0; i < 100; ++i)
+                    scene->create().emplace<Counter>();
+            }
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        engine.reset();
+
+        for (auto& scene : scenes)
+            scene.reset();
+    }
+
+    [[nodiscard]] static int sum(Game::Scene& scene)
+    {
+        int result = 0;
+
+        scene.filtered<Counter const>().each([&result] (Counter const& counter) {
+            result += counter.value;
+        });
+
+        return result;
+    }
+
+    std::unique_ptr<Generic::Engine> engine;
+    std::array<std::shared_ptr<Game::Scene>, 3> scenes;
+};
+
+/* Shards */
+
+TEST_F(ShardTest, InvalidStep)
+{
+    EXPECT_THROW(engine->add_shard(scenes[0], std::chrono::nanoseconds::zero()), std::invalid_argument);
+    EXPECT_EQ(engine->shard_count(), 0u);
+
+    auto& shard = engine->add_shard(scenes[0]);
+
+    EXPECT_THROW(shard.step(std::chrono::nanoseconds(-1)), std::invalid_argument);
+    EXPECT_EQ(shard.step(), Generic::Shard::default_step);
+}
+
+TEST_F(ShardTest, TickRates)
+{
+    using namespace std::chrono_literals;
+
+    Generic::Engine::LoopSettings loop;
+    loop.step = 10ms;
+    engine->loop_settings(loop);
+
+    engine->active_scene(scenes[0]);
+    ASSERT_NO_THROW(engine->make_system<CountSystem>());
+
+    auto& fast = engine->add_shard(scenes[1], 10ms);
+    auto& slow = engine->add_shard(scenes[2], 20ms);
+
+    ASSERT_NO_THROW(fast.make_system<CountSystem>());
+    ASSERT_NO_THROW(slow.make_system<CountSystem>());
+
+    engine->run_frames(10);
+
+    EXPECT_EQ(fast.frames(), 10u);
+    EXPECT_EQ(slow.frames(), 5u);
+
+    EXPECT_EQ(sum(*scenes[0]), 1000);
+    EXPECT_EQ(sum(*scenes[1]), 1000);
+    EXPECT_EQ(sum(*scenes[2]), 500);
+
+    EXPECT_EQ(engine->find_system<CountSystem>()->myUpdates, 10u);
+    EXPECT_EQ(slow.find_system<CountSystem>()->myUpdates, 5u);
+
+    EXPECT_EQ(engine->stats().frame().samples, 10u);
+    EXPECT_EQ(fast.stats().frame().samples, 10u);
+    EXPECT_EQ(slow.stats().frame().samples, 5u);
+    EXPECT_EQ(slow.system_stats<CountSystem>().samples, 5u);
+}
+
+TEST_F(ShardTest, DuplicateScene)
+{
+    engine->active_scene(scenes[0]);
+    engine->add_shard(scenes[1]);
+
+    EXPECT_THROW(engine->add_shard(scenes[0]), std::invalid_argument);
+    EXPECT_THROW(engine->add_shard(scenes[1]), std::invalid_argument);
+    EXPECT_THROW(engine->active_scene(scenes[1]), std::invalid_argument);
+
+    EXPECT_EQ(engine->shard_count(), 1u);
+    EXPECT_EQ(engine->active_scene().lock(), scenes[0]);
+
+    EXPECT_NO_THROW(engine->active_scene(scenes[0]));
+    EXPECT_NO_THROW(engine->active_scene(scenes[2]));
+    EXPECT_NO_THROW(engine->add_shard(scenes[0]));
+    EXPECT_NO_THROW(engine->add_shard(std::weak_ptr<Game::Scene> {}));
+    EXPECT_NO_THROW(engine->add_shard(std::weak_ptr<Game::Scene> {}));
+}
+
+TEST_F(ShardTest, WithoutActiveScene)
+{
+    auto& shard = engine->add_shard(scenes[1], engine->loop_settings().step);
+    ASSERT_NO_THROW(shard.make_system<CountSystem>());
+
+    engine->run_frames(3);
+
+    EXPECT_EQ(shard.frames(), 3u);
+    EXPECT_EQ(sum(*scenes[1]), 300);
+
+    scenes[1].reset();
+    engine->run_frames(3);
+
+    EXPECT_EQ(shard.frames(), 3u);
+}
+
+TEST_F(ShardTest, Failure)
+{
+    engine->active_scene(scenes[0]);
+    ASSERT_NO_THROW(engine->make_system<CountSystem>());
+
+    auto& shard = engine->add_shard(scenes[1], engine->loop_settings().step);
+    ASSERT_NO_THROW(shard.make_system<ThrowSystem>());
+
+    EXPECT_THROW(engine->run_frames(1), std::runtime_error);
+
+    engine->remove_shard(shard);
+
+    EXPECT_EQ(engine->shard_count(), 0u);
+    EXPECT_NO_THROW(engine->run_frames(1));
+}
@@ -0,0 +1,141 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Counter { int value = 0; };
+
+    class CountSystem final :
+        public Generic::SystemBase<Counter>
+    {
+    public:
+        void process(Counter& counter) override {
+            ++counter.value;
+        }
+
+        void update() override {}
+    };
+}
+
+class FrameStatsTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            stats = std::make_unique<Generic::FrameStats>(100);
+            system = std::make_unique<CountSystem>();
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        system.reset();
+        stats.reset();
+    }
+
+    void record(std::int64_t time)
+    {
+        Generic::SystemTiming const timing { system.get(), std::chrono::nanoseconds(time * 2), 10 };
+        stats->record(std::chrono::nanoseconds(time), std::span { &timing, 1 });
+    }
+
+    std::unique_ptr<Generic::FrameStats> stats;
+    std::unique_ptr<CountSystem> system;
+};
+
+/* Create */
+
+TEST_F(FrameStatsTest, ZeroCapacity) {
+    EXPECT_THROW(Generic::FrameStats { 0 }, std::invalid_argument);
+}
+
+/* Summary */
+
+TEST_F(FrameStatsTest, Empty)
+{
+    EXPECT_EQ(stats->frame().samples, 0u);
+    EXPECT_EQ(stats->system(*system).samples, 0u);
+}
+
+TEST_F(FrameStatsTest, Percentiles)
+{
+    for (std::int64_t i = 100; i >= 1; --i)
+        ASSERT_NO_THROW(record(i));
+
+    auto const frame = stats->frame();
+
+    EXPECT_EQ(frame.samples, 100u);
+    EXPECT_EQ(frame.p50.count(), 50);
+    EXPECT_EQ(frame.p95.count(), 95);
+    EXPECT_EQ(frame.p99.count(), 99);
+    EXPECT_EQ(frame.max.count(), 100);
+
+    auto const summary = stats->system(*system);
+
+    EXPECT_EQ(summary.samples, 100u);
+    EXPECT_EQ(summary.p50.count(), 100);
+    EXPECT_EQ(summary.max.count(), 200);
+    EXPECT_EQ(summary.processed, 10u);
+}
+
+TEST_F(FrameStatsTest, Ring)
+{
+    for (std::int64_t i = 1; i <= 250; ++i)
+        ASSERT_NO_THROW(record(i));
+
+    auto const frame = stats->frame();
+
+    EXPECT_EQ(stats->recorded(), 250u);
+    EXPECT_EQ(frame.samples, 100u);
+    EXPECT_EQ(frame.max.count(), 250);
+    EXPECT_EQ(frame.p50.count(), 200);
+}
+
+TEST_F(FrameStatsTest, RemovedSystem)
+{
+    ASSERT_NO_THROW(record(1));
+    ASSERT_NO_THROW(stats->record(std::chrono::nanoseconds(1), {}));
+
+    EXPECT_EQ(stats->system(*system).samples, 0u);
+    EXPECT_EQ(stats->frame().samples, 2u);
+
+    ASSERT_NO_THROW(record(1));
+    EXPECT_EQ(stats->system(*system).samples, 1u);
+}
+
+/* Engine */
+
+TEST_F(FrameStatsTest, RunFrames)
+{
+    auto const scene = std::make_shared<Game::Scene>();
+    Generic::Engine engine;
+
+    for (int i = 0; i < 5; ++i)
+        scene->create().emplace<Counter>();
+
+    engine.active_scene(scene);
+    ASSERT_NO_THROW(engine.make_system<CountSystem>());
+
+    auto const& result = engine.run_frames(20);
+
+    EXPECT_EQ(result.recorded(), 20u);
+    EXPECT_EQ(result.frame().samples, 20u);
+
+    auto const summary = engine.system_stats<CountSystem>();
+
+    EXPECT_EQ(summary.samples, 20u);
+    EXPECT_EQ(summary.processed, 5u);
+    EXPECT_LE(summary.p50, summary.p99);
+
+    scene->filtered<Counter const>().each([] (Counter const& counter) {
+        EXPECT_EQ(counter.value, 20);
+    });
+}
@@ -0,0 +1,267 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include "frame_services.h"
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Position { int value = 0; };
+    struct Health { int value = 10; };
+    struct Dead {};
+    struct Frozen {};
+
+    class MoveSystem final :
+        public Generic::SystemBase<Position, entt::exclude_t<Dead, Frozen>>
+    {
+    public:
+        void process(Position& position) override {
+            ++position.value;
+        }
+
+        void update() override {}
+    };
+
+    class HealSystem final :
+        public Generic::SystemBase<Position const, Health*, entt::exclude_t<Dead>>
+    {
+    public:
+        void process(Position const&, Health* const health) override
+        {
+            if (health) {
+                ++health->value;
+                ++healed;
+            }
+            else
+                ++missing;
+        }
+
+        void update() override {}
+
+        std::size_t healed = 0;
+        std::size_t missing = 0;
+    };
+
+    class GroupedMoveSystem final :
+        public Generic::SystemBase<Health const, entt::owned_t<Position>, entt::exclude_t<Dead>>
+    {
+    public:
+        void process(Health const& health, Position& position) override {
+            position.value += health.value;
+        }
+
+        void update() override {}
+    };
+
+    class StaticGroupedSystem final :
+        public Generic::StaticSystem<StaticGroupedSystem, entt::owned_t<Position const>, Health*>
+    {
+    public:
+        void process(Position const&, Health* const health) {
+            total += health ? health->value : 0;
+        }
+
+        int total = 0;
+    };
+
+    class StaticHealSystem final :
+        public Generic::StaticSystem<StaticHealSystem, Health const*, Position const>
+    {
+    public:
+        void process(Health const* const health, Position const&) {
+            total += health ? health->value : 0;
+        }
+
+        int total = 0;
+    };
+
+    class SinkSystem final :
+        public Generic::SystemBase<Game::Components::Layer, Position const>
+    {
+    public:
+        void process(Game::Components::Layer& layer, Position const& position) override {
+            layer.layer(-position.value);
+        }
+
+        void update() override {}
+    };
+}
+
+class SystemTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_unique<Game::Scene>();
+            services = std::make_unique<FrameServices>(0);
+
+            for (int i = 0; i < 30; ++i) {
+                auto object = scene->create();
+                object.emplace<Position>();
+
+                if (i % 2 == 0)
+                    object.emplace<Health>();
+
+                if (i % 3 == 0)
+                    object.emplace<Dead>();
+
+                if (i % 5 == 0)
+                    object.emplace<Frozen>();
+
+                objects.push_back(object);
+            }
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        objects.clear();
+        services.reset();
+        scene.reset();
+    }
+
+    void run(Generic::Detail::SystemBase& system)
+    {
+        auto const frame = services->frame();
+
+        system.prepare(*scene, frame);
+        system.run(*scene, frame);
+    }
+
+    std::unique_ptr<Game::Scene> scene;
+    std::unique_ptr<FrameServices> services;
+    std::vector<Game::ObjectHandle> objects;
+};
+
+/* Signature */
+
+TEST_F(SystemTest, Exclude)
+{
+    MoveSystem system;
+    run(system);
+
+    EXPECT_EQ(system.processed(), 16u);
+
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        EXPECT_EQ(objects[i].get<Position>().value, i % 3 != 0 && i % 5 != 0 ? 1 : 0);
+}
+
+TEST_F(SystemTest, Optional)
+{
+    HealSystem system;
+    run(system);
+
+    EXPECT_EQ(system.healed, 10u);
+    EXPECT_EQ(system.missing, 10u);
+
+    for (std::size_t i = 0; i < objects.size(); i += 2)
+        EXPECT_EQ(objects[i].get<Health>().value, i % 3 != 0 ? 11 : 10);
+}
+
+TEST_F(SystemTest, OptionalBudget)
+{
+    HealSystem system;
+    system.run_policy(Generic::RunPolicy::budget(std::chrono::seconds(1)));
+    run(system);
+
+    EXPECT_EQ(system.healed + system.missing, system.processed());
+    EXPECT_EQ(system.healed, 10u);
+}
+
+TEST_F(SystemTest, StaticOptional)
+{
+    StaticHealSystem system;
+    run(system);
+
+    EXPECT_EQ(system.total, 150);
+    EXPECT_EQ(system.processed(), 30u);
+}
+
+TEST_F(SystemTest, Access)
+{
+    auto const move = MoveSystem {}.access();
+    auto const heal = HealSystem {}.access();
+
+    EXPECT_FALSE(move.is_exclusive());
+    EXPECT_TRUE(move.conflicts(heal));
+    EXPECT_TRUE(heal.conflicts(StaticHealSystem {}.access()));
+}
+
+TEST_F(SystemTest, Grouped)
+{
+    GroupedMoveSystem system;
+    run(system);
+
+    EXPECT_EQ(system.processed(), 10u);
+
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        EXPECT_EQ(objects[i].get<Position>().value, i % 2 == 0 && i % 3 != 0 ? 10 : 0);
+
+    StaticGroupedSystem other;
+    EXPECT_THROW(run(other), std::invalid_argument);
+}
+
+TEST_F(SystemTest, GroupedBudget)
+{
+    GroupedMoveSystem system;
+    system.run_policy(Generic::RunPolicy::budget(std::chrono::seconds(1)));
+    run(system);
+
+    EXPECT_EQ(system.processed(), 10u);
+}
+
+TEST_F(SystemTest, StaticGrouped)
+{
+    StaticGroupedSystem system;
+    run(system);
+
+    EXPECT_EQ(system.total, 150);
+    EXPECT_EQ(system.processed(), 30u);
+}
+
+TEST_F(SystemTest, LayerOrder)
+{
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+        objects[i].emplace<Game::Components::Layer>(static_cast<long long>(i));
+        objects[i].get<Position>().value = static_cast<int>(i);
+    }
+
+    scene->keep_layer_order<Position>();
+    EXPECT_FALSE(scene->update_layer_order());
+
+    SinkSystem system;
+    run(system);
+
+    EXPECT_TRUE(scene->update_layer_order());
+    EXPECT_EQ(*scene->filtered<Game::Components::Layer const>().begin(), objects.back().entity());
+
+    HealSystem other;
+    run(other);
+
+    EXPECT_FALSE(scene->update_layer_order());
+
+    MoveSystem dependent;
+    run(dependent);
+
+    EXPECT_FALSE(scene->update_layer_order());
+}
+
+/* Scene */
+
+TEST_F(SystemTest, FilteredExclude)
+{
+    std::size_t count = 0;
+
+    scene->filtered<Position const>(entt::exclude<Dead>).each([&count] (Position const&) {
+        ++count;
+    });
+
+    EXPECT_EQ(count, 20u);
+}
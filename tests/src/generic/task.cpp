@@ -0,0 +1,201 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace Coli;
+using namespace std::chrono_literals;
+
+namespace
+{
+    Generic::Task count_frames(std::vector<int>& log, int id, std::uint64_t frames)
+    {
+        log.push_back(id);
+
+        for (std::uint64_t i = 0; i < frames; ++i) {
+            co_await Generic::Task::next_frame();
+            log.push_back(id);
+        }
+    }
+
+    Generic::Task wait_delay(bool& finished, std::chrono::nanoseconds delay)
+    {
+        co_await Generic::Task::delay(delay);
+        finished = true;
+    }
+
+    Generic::Task child(int& value)
+    {
+        co_await Generic::Task::frames(2);
+        value += 10;
+    }
+
+    Generic::Task parent(int& value)
+    {
+        value = 1;
+        co_await child(value);
+        value *= 2;
+    }
+
+    Generic::Task failing()
+    {
+        co_await Generic::Task::next_frame();
+        throw std::runtime_error("task failure");
+    }
+
+    Generic::Task catching(bool& caught)
+    {
+        try {
+            co_await failing();
+        }
+        catch (std::runtime_error const&) {
+            caught = true;
+        }
+    }
+}
+
+class TaskTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            tasks = std::make_unique<Generic::TaskScheduler>();
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        tasks.reset();
+    }
+
+    std::unique_ptr<Generic::TaskScheduler> tasks;
+};
+
+/* Start */
+
+TEST_F(TaskTest, Lazy)
+{
+    std::vector<int> log;
+    auto task = count_frames(log, 1, 0);
+
+    EXPECT_TRUE(log.empty());
+    EXPECT_FALSE(task.done());
+
+    ASSERT_NO_THROW(tasks->start(std::move(task)));
+    EXPECT_TRUE(log.empty());
+    EXPECT_EQ(tasks->size(), 1u);
+
+    ASSERT_NO_THROW(tasks->update(1ms));
+    EXPECT_EQ(log, std::vector<int>{ 1 });
+    EXPECT_EQ(tasks->size(), 0u);
+}
+
+TEST_F(TaskTest, Empty) {
+    EXPECT_THROW(tasks->start(Generic::Task {}), std::invalid_argument);
+}
+
+/* Await */
+
+TEST_F(TaskTest, Frames)
+{
+    std::vector<int> log;
+
+    ASSERT_NO_THROW(tasks->start(count_frames(log, 1, 2)));
+    ASSERT_NO_THROW(tasks->start(count_frames(log, 2, 1)));
+
+    for (int i = 0; i < 3; ++i)
+        ASSERT_NO_THROW(tasks->update(1ms));
+
+    EXPECT_EQ(log, (std::vector<int>{ 1, 2, 1, 2, 1 }));
+    EXPECT_EQ(tasks->size(), 0u);
+}
+
+TEST_F(TaskTest, Delay)
+{
+    bool finished = false;
+
+    ASSERT_NO_THROW(tasks->start(wait_delay(finished, 25ms)));
+
+    for (int i = 0; i < 3; ++i)
+        ASSERT_NO_THROW(tasks->update(10ms));
+
+    EXPECT_FALSE(finished);
+
+    ASSERT_NO_THROW(tasks->update(10ms));
+    EXPECT_TRUE(finished);
+    EXPECT_EQ(tasks->time(), 40ms);
+}
+
+TEST_F(TaskTest, AwaitTask)
+{
+    int value = 0;
+
+    ASSERT_NO_THROW(tasks->start(parent(value)));
+    ASSERT_NO_THROW(tasks->update(1ms));
+    EXPECT_EQ(value, 1);
+
+    ASSERT_NO_THROW(tasks->update(1ms));
+    ASSERT_NO_THROW(tasks->update(1ms));
+
+    EXPECT_EQ(value, 22);
+    EXPECT_EQ(tasks->size(), 0u);
+}
+
+/* Exceptions */
+
+TEST_F(TaskTest, Rethrow)
+{
+    ASSERT_NO_THROW(tasks->start(failing()));
+    ASSERT_NO_THROW(tasks->update(1ms));
+
+    EXPECT_THROW(tasks->update(1ms), std::runtime_error);
+    EXPECT_EQ(tasks->size(), 0u);
+}
+
+TEST_F(TaskTest, AwaitRethrow)
+{
+    bool caught = false;
+
+    ASSERT_NO_THROW(tasks->start(catching(caught)));
+
+    for (int i = 0; i < 2; ++i)
+        ASSERT_NO_THROW(tasks->update(1ms));
+
+    EXPECT_TRUE(caught);
+}
+
+/* Destroy */
+
+TEST_F(TaskTest, DestroySuspended)
+{
+    int value = 0;
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_NO_THROW(tasks->start(parent(value)));
+
+    ASSERT_NO_THROW(tasks->update(1ms));
+    EXPECT_EQ(tasks->size(), 1000u);
+
+    tasks.reset();
+}
+
+/* Engine */
+
+TEST_F(TaskTest, Engine)
+{
+    auto const scene = std::make_shared<Game::Scene>();
+    Generic::Engine engine;
+    std::vector<int> log;
+
+    engine.active_scene(scene);
+
+    ASSERT_NO_THROW(engine.start_task(count_frames(log, 1, 3)));
+    ASSERT_NO_THROW(engine.run_frames(10));
+
+    EXPECT_EQ(log.size(), 4u);
+    EXPECT_EQ(engine.tasks().size(), 0u);
+}
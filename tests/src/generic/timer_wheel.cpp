@@ -0,0 +1,266 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace Coli;
+
+namespace
+{
+    struct Cooldown {};
+
+    class CooldownSystem final :
+        public Generic::SystemBase<Cooldown const>
+    {
+    public:
+        void process(Cooldown const&) override {}
+
+        void update() override
+        {
+            fired.push_back(frame().timers().fired().size());
+
+            if (frame().index() == 0)
+                for (auto const entity : frame().timers().fired())
+                    frame().timers().schedule(entity, 1);
+        }
+
+        std::vector<std::size_t> fired;
+    };
+}
+
+class TimerWheelTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            scene = std::make_shared<Game::Scene>();
+
+            for (int i = 0; i < 100; ++i)
+                objects.push_back(scene->create());
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        objects.clear();
+        scene.reset();
+    }
+
+    [[nodiscard]] entt::entity entity(std::size_t const index) const noexcept {
+        return objects[index].entity();
+    }
+
+    std::shared_ptr<Game::Scene> scene;
+    std::vector<Game::ObjectHandle> objects;
+};
+
+/* Wheel */
+
+TEST_F(TimerWheelTest, FireOnce)
+{
+    Generic::TimerWheel wheel;
+
+    wheel.schedule(entity(0), 3);
+    wheel.schedule(entity(1), 0);
+
+    EXPECT_EQ(wheel.size(), 2u);
+    EXPECT_EQ(wheel.remaining(entity(0)), 3u);
+
+    wheel.advance();
+
+    ASSERT_EQ(wheel.fired().size(), 1u);
+    EXPECT_EQ(wheel.fired().front(), entity(1));
+
+    wheel.advance();
+    EXPECT_TRUE(wheel.fired().empty());
+
+    wheel.advance();
+
+    ASSERT_EQ(wheel.fired().size(), 1u);
+    EXPECT_EQ(wheel.fired().front(), entity(0));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST_F(TimerWheelTest, Cascade)
+{
+    Generic::TimerWheel wheel;
+    std::vector<std::uint64_t> const delays { 63, 64, 65, 4095, 4096, 4097, 300'000, 20'000'000 };
+
+    for (std::size_t i = 0; i < delays.size(); ++i)
+        wheel.schedule(entity(i), delays[i]);
+
+    std::vector<std::uint64_t> fired(delays.size(), 0);
+
+    while (!wheel.empty()) {
+        wheel.advance();
+
+        for (auto const object : wheel.fired())
+            fired[entt::to_entity(object)] = wheel.now();
+    }
+
+    for (std::size_t i = 0; i < delays.size(); ++i)
+        EXPECT_EQ(fired[entt::to_entity(entity(i))], delays[i]);
+}
+
+TEST_F(TimerWheelTest, CancelAndReschedule)
+{
+    Generic::TimerWheel wheel;
+
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        wheel.schedule(entity(i), 10);
+
+    for (std::size_t i = 0; i < objects.size(); i += 2)
+        EXPECT_TRUE(wheel.cancel(entity(i)));
+
+    EXPECT_FALSE(wheel.cancel(entity(0)));
+    EXPECT_FALSE(wheel.scheduled(entity(0)));
+
+    wheel.schedule(entity(1), 20);
+
+    for (int i = 0; i < 10; ++i)
+        wheel.advance();
+
+    EXPECT_EQ(wheel.fired().size(), objects.size() / 2 - 1);
+    EXPECT_EQ(wheel.size(), 1u);
+    EXPECT_EQ(wheel.remaining(entity(1)), 10u);
+}
+
+TEST_F(TimerWheelTest, RecycledEntity)
+{
+    Generic::TimerWheel wheel;
+
+    auto const old = entity(0);
+    wheel.schedule(old, 5);
+
+    scene->destroy(objects[0]);
+    auto const recycled = scene->create().entity();
+
+    ASSERT_EQ(entt::to_entity(recycled), entt::to_entity(old));
+
+    EXPECT_FALSE(wheel.scheduled(recycled));
+    EXPECT_FALSE(wheel.cancel(recycled));
+    EXPECT_TRUE(wheel.scheduled(old));
+}
+
+/* Frame timers */
+
+TEST_F(TimerWheelTest, DeferredRequests)
+{
+    Generic::WorkerPool workers { 2 };
+    Generic::FrameTimers timers { workers.slot_count() };
+
+    workers.parallel_for(0, objects.size(), 8, [this, &timers] (std::size_t const first, std::size_t const last) {
+        for (auto i = first; i < last; ++i)
+            timers.schedule(entity(i), 2);
+    });
+
+    timers.cancel(entity(0));
+
+    EXPECT_TRUE(timers.wheel().empty());
+
+    timers.flush();
+
+    EXPECT_EQ(timers.wheel().size(), objects.size() - 1);
+
+    timers.advance();
+    timers.advance();
+
+    EXPECT_EQ(timers.fired().size(), objects.size() - 1);
+}
+
+TEST_F(TimerWheelTest, Engine)
+{
+    for (std::size_t i = 0; i < 10; ++i)
+        objects[i].emplace<Cooldown>();
+
+    Generic::Engine engine;
+    engine.active_scene(scene);
+
+    for (std::size_t i = 0; i < 10; ++i)
+        engine.timers().schedule(entity(i), 1);
+
+    engine.timers().flush();
+
+    auto const system = engine.make_system<CooldownSystem>().lock();
+    engine.run_frames(3);
+
+    ASSERT_EQ(system->fired.size(), 3u);
+    EXPECT_EQ(system->fired[0], 10u);
+    EXPECT_EQ(system->fired[1], 10u);
+    EXPECT_EQ(system->fired[2], 0u);
+}
+
+/* Time to live */
+
+TEST_F(TimerWheelTest, TimeToLive)
+{
+    using Game::Components::TimeToLive;
+
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        objects[i].emplace<TimeToLive>(static_cast<Types::float_type>(i % 4));
+
+    Generic::Engine engine;
+    engine.active_scene(scene);
+
+    ASSERT_NO_THROW(engine.make_system<Generic::TimeToLiveSystem>());
+
+    auto const alive = [this] {
+        return std::ranges::count_if(objects, [] (auto const& object) { return !object.expired(); });
+    };
+
+    engine.run_frames(1);
+    EXPECT_EQ(alive(), 75);
+
+    objects[1].patch<TimeToLive>([] (TimeToLive& ttl) {
+        ttl.seconds(10);
+    });
+
+    engine.run_frames(70);
+    EXPECT_EQ(alive(), 51);
+
+    Game::CommandBuffer buffer { *scene };
+    buffer.remove<TimeToLive>(objects[2].entity());
+    buffer.flush();
+
+    engine.run_frames(200);
+
+    EXPECT_EQ(alive(), 2);
+    EXPECT_FALSE(objects[1].expired());
+    EXPECT_FALSE(objects[2].expired());
+    EXPECT_TRUE(objects[3].expired());
+}
+
+TEST_F(TimerWheelTest, TimeToLiveRunPolicy)
+{
+    using Game::Components::TimeToLive;
+
+    for (auto& object : objects)
+        object.emplace<TimeToLive>(Types::float_type { 1 });
+
+    Generic::Engine engine;
+    engine.active_scene(scene);
+
+    ASSERT_NO_THROW(engine.make_system<Generic::TimeToLiveSystem>(Generic::RunPolicy::every(4)));
+
+    auto const alive = [this] {
+        return std::ranges::count_if(objects, [] (auto const& object) { return !object.expired(); });
+    };
+
+    engine.run_frames(48);
+    EXPECT_EQ(alive(), 100);
+
+    engine.run_frames(20);
+    EXPECT_EQ(alive(), 0);
+}
+
+TEST_F(TimerWheelTest, TimeToLiveTick)
+{
+    EXPECT_THROW(Generic::TimeToLiveSystem { std::chrono::nanoseconds::zero() }, std::invalid_argument);
+
+    Generic::TimeToLiveSystem const system { std::chrono::milliseconds(10) };
+    EXPECT_TRUE(system.wheel().empty());
+}
@@ -0,0 +1,173 @@
+#include <coli/game-engine.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace Coli;
+
+class WorkerPoolTest :
+    public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        try {
+            workers = std::make_unique<Generic::WorkerPool>(3);
+        }
+        catch (std::exception const& e) {
+            GTEST_SKIP() << "An exception was thrown: " << e.what() << "." << std::endl;
+        }
+    }
+
+    void TearDown() override {
+        workers.reset();
+    }
+
+    std::unique_ptr<Generic::WorkerPool> workers;
+};
+
+/* Create */
+
+TEST_F(WorkerPoolTest, Create)
+{
+    EXPECT_EQ(workers->worker_count(), 3u);
+    EXPECT_EQ(workers->slot_count(), 4u);
+    EXPECT_EQ(Generic::WorkerPool::current_slot(), 0u);
+}
+
+TEST_F(WorkerPoolTest, Pinned)
+{
+    std::unique_ptr<Generic::WorkerPool> pinned;
+    ASSERT_NO_THROW(pinned = std::make_unique<Generic::WorkerPool>(2, true));
+
+    std::atomic<int> sum = 0;
+    Generic::JobCounter counter;
+
+    for (int i = 1; i <= 10; ++i)
+        ASSERT_NO_THROW(pinned->submit([&sum, i] { sum += i; }, counter));
+
+    pinned->wait(counter);
+    EXPECT_EQ(sum.load(), 55);
+}
+
+/* Counters */
+
+TEST_F(WorkerPoolTest, Counter)
+{
+    std::atomic<int> sum = 0;
+    Generic::JobCounter counter;
+
+    EXPECT_TRUE(counter.done());
+
+    for (int i = 1; i <= 100; ++i)
+        ASSERT_NO_THROW(workers->submit([&sum, i] { sum += i; }, counter));
+
+    workers->wait(counter);
+
+    EXPECT_TRUE(counter.done());
+    EXPECT_EQ(sum.load(), 5050);
+}
+
+TEST_F(WorkerPoolTest, Children)
+{
+    std::atomic<int> count = 0;
+    Generic::JobCounter counter;
+
+    ASSERT_NO_THROW(workers->submit([this, &count] {
+        for (int i = 0; i < 10; ++i)
+            workers->submit_child([this, &count] {
+                for (int j = 0; j < 10; ++j)
+                    workers->submit_child([&count] { ++count; });
+
+                ++count;
+            });
+
+        ++count;
+    }, counter));
+
+    workers->wait(counter);
+    EXPECT_EQ(count.load(), 111);
+}
+
+TEST_F(WorkerPoolTest, HelpWhileWaiting)
+{
+    Generic::WorkerPool inline_pool { 0 };
+    Generic::JobCounter counter;
+    std::vector<std::size_t> slots;
+
+    for (int i = 0; i < 5; ++i)
+        ASSERT_NO_THROW(inline_pool.submit([&slots] {
+            slots.push_back(Generic::WorkerPool::current_slot());
+        }, counter));
+
+    EXPECT_EQ(counter.value(), 5u);
+
+    inline_pool.wait(counter);
+    EXPECT_EQ(slots, std::vector<std::size_t>(5, 0));
+}
+
+TEST_F(WorkerPoolTest, CheckedSlot)
+{
+    std::atomic<std::size_t> mismatches = 0;
+
+    EXPECT_EQ(Generic::WorkerPool::current_slot(1), 0u);
+
+    workers->parallel_for(0, 64, 1, [&mismatches] (std::size_t, std::size_t)
+    {
+        auto const slot = Generic::WorkerPool::current_slot();
+        bool thrown = false;
+
+        try {
+            static_cast<void>(Generic::WorkerPool::current_slot(1));
+        }
+        catch (std::out_of_range const&) {
+            thrown = true;
+        }
+
+        if (thrown != (slot != 0) || Generic::WorkerPool::current_slot(slot + 1) != slot)
+            ++mismatches;
+    });
+
+    EXPECT_EQ(mismatches.load(), 0u);
+}
+
+/* Parallel for */
+
+TEST_F(WorkerPoolTest, ParallelFor)
+{
+    std::vector<int> values (10'000, 0);
+
+    workers->parallel_for(0, values.size(), 64, [&values] (std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i)
+            values[i] += static_cast<int>(i);
+    });
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+        ASSERT_EQ(values[i], static_cast<int>(i));
+}
+
+TEST_F(WorkerPoolTest, ParallelForThrows)
+{
+    EXPECT_THROW(workers->parallel_for(0, 1000, 10, [] (std::size_t first, std::size_t) {
+        if (first == 500)
+            throw std::runtime_error("chunk failure");
+    }), std::runtime_error);
+}
+
+/* Engine */
+
+TEST_F(WorkerPoolTest, EngineSettings)
+{
+    Generic::Engine engine;
+    Generic::Engine::WorkerSettings settings;
+
+    settings.count = 2;
+    engine.worker_settings(settings);
+
+    EXPECT_EQ(engine.workers().worker_count(), 2u);
+
+    settings.count = 1;
+    engine.worker_settings(settings);
+
+    EXPECT_EQ(engine.workers().worker_count(), 1u);
+}